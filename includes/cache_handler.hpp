@@ -0,0 +1,78 @@
+/******************************************************************************/
+//
+//  Source Name:                cache_handler.hpp
+//
+//  Description:                This file is responsible for the on-disk
+//                              cache of compiled programs.
+//
+//                              A program's bytecode is written to a cache
+//                              file next to its source, keyed by a hash of
+//                              the source contents and the interpreter
+//                              version. A later run of the same unchanged
+//                              source loads the bytecode from the cache,
+//                              skipping the lexer, parser and compiler.
+//
+//                              A cache file that is missing, stale or
+//                              damaged is ignored, and the program is
+//                              compiled as usual.
+//
+//  Dependencies:               source_handler.hpp
+//                              compiler_utils.hpp
+//
+//  Classes:                    None
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       get_cache_path
+//                              hash_src
+//                              load_cache
+//                              save_cache
+//
+/******************************************************************************/
+
+#ifndef CACHE_HANDLER
+#define CACHE_HANDLER
+
+/******************************************************************************/
+
+#include <cstdint>                      // uint32_t, uint64_t
+#include <memory>                       // std::shared_ptr
+#include <string>                       // std::string
+
+#include "source_handler.hpp"
+#include "utils/compiler_utils.hpp"
+
+/******************************************************************************/
+
+// The interpreter version. A cache written by another version is stale.
+#define ROSKY_VERSION "1.0"
+
+// The version of the cache file layout. This must be bumped whenever the
+// layout of Chunk_T or the instruction set changes.
+#define CACHE_FORMAT 3
+
+// The extension appended to a source file name to form its cache file.
+#define CACHE_EXT "c"
+
+/******************************************************************************/
+
+// This function returns the cache file path of a source file.
+std::string get_cache_path(const std::string& __filename);
+
+// This function returns the hash of a source's contents.
+uint64_t hash_src(const Src_T& __src) noexcept;
+
+// This function loads the compiled program of a source from its cache
+// file. Returns nullptr if the file is missing, or was written for other
+// contents or by another interpreter version.
+std::shared_ptr<Chunk_T> load_cache(const std::string& __path, uint64_t __hash);
+
+// This function writes the compiled program of a source to its cache
+// file. A cache that cannot be written is skipped silently.
+void save_cache(const std::string& __path, uint64_t __hash, const Chunk_T& __chunk);
+
+/******************************************************************************/
+
+#endif // CACHE_HANDLER
+
+/******************************************************************************/
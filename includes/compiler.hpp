@@ -0,0 +1,164 @@
+/******************************************************************************/
+//
+//  Source Name:                compiler.hpp
+//
+//  Description:                This file is responsible for compiling
+//                              the statement tree generated by the parser
+//                              into bytecode for the virtual machine.
+//
+//                              Every user function is compiled into its
+//                              own chunk, which is nested in the chunk
+//                              it is defined in.
+//
+//                              Variables assigned within a chunk are
+//                              resolved to a slot of its frame, so the
+//                              virtual machine only looks a variable up
+//                              by name when it belongs to a caller.
+//
+//  Dependencies:               parser_utils.hpp
+//                              compiler_utils.hpp
+//                              error_handler.hpp
+//
+//  Classes:                    Compiler_T
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       Ctor.
+//                              compile
+//
+/******************************************************************************/
+
+#ifndef BYTECODE_COMPILER
+#define BYTECODE_COMPILER
+
+/******************************************************************************/
+
+#include <memory>                       // std::shared_ptr
+#include <string>                       // std::string
+#include <vector>                       // std::vector
+#include <unordered_map>                // std::unordered_map
+#include <utility>                      // std::pair
+
+#include "utils/parser_utils.hpp"
+#include "utils/compiler_utils.hpp"
+
+#include "error_handler.hpp"
+
+/******************************************************************************/
+
+// This class provides the definition for the compiler object. It holds
+// the chunk being compiled along with the state needed to lay out
+// scopes and loops.
+class Compiler_T {
+
+private:
+
+    // This struct holds the jump information of a loop being compiled,
+    // so that break and continue statements can be resolved.
+    struct LoopInfo_T {
+
+        // The instruction a continue jumps to.
+        size_t _cont_target;
+
+        // The jump instructions of each break, patched to the loop exit.
+        std::vector<size_t> _breaks;
+
+    };
+
+    // The token table the expression nodes refer to.
+    const TokenTable_T& _tokens;
+
+    // The arena holding the expressions of the chunk being compiled.
+    const ExprArena_T* _arena;
+
+    // The chunk currently being compiled.
+    std::shared_ptr<Chunk_T> _chunk;
+
+    // The scope depth relative to the scope a chunk's frame starts at.
+    size_t _depth;
+
+    // The loops enclosing the statement being compiled.
+    std::vector<LoopInfo_T> _loops;
+
+    // The program-wide id of every symbol name.
+    std::unordered_map<std::string, size_t> _symbols;
+
+    // The constant of each literal in the chunk, keyed by the token's
+    // kind and text id, and of each folded constant, keyed by its index
+    // in the arena with the top bit set.
+    std::unordered_map<uint64_t, size_t> _const_ids;
+
+    // The slot of each variable assigned within the chunk.
+    std::unordered_map<std::string, size_t> _slots;
+
+    // The slots of the loop variables of the enclosing for loops, which
+    // shadow the chunk's variables of the same name.
+    std::vector<std::pair<std::string, size_t>> _iter_slots;
+
+    // Every slot stored to so far within the chunk, in order. A release
+    // unbinds the slots stored to since its statement began.
+    std::vector<size_t> _stores;
+
+public:
+
+    // Ctor.
+    Compiler_T(const TokenTable_T& __tokens)
+        : _tokens(__tokens), _arena(nullptr), _chunk(nullptr), _depth(0) {}
+
+    // This function compiles the statements of a program, whose
+    // expressions are held in the given arena, into the main chunk
+    // and returns it.
+    std::shared_ptr<Chunk_T> compile(const std::vector<std::shared_ptr<StmtNode>>& __stmts,
+                                     const std::shared_ptr<ExprArena_T>& __arena);
+
+private:
+
+    // These functions compile statements.
+    void compile_stmts(const std::vector<std::shared_ptr<StmtNode>>& __stmts);
+    void compile_block(const std::shared_ptr<StmtNode>& __block, size_t __depth);
+    void compile_if(const std::shared_ptr<StmtNode>& __stmt);
+    void compile_while(const std::shared_ptr<StmtNode>& __stmt);
+    void compile_for(const std::shared_ptr<StmtNode>& __stmt);
+    void compile_func_def(const std::shared_ptr<StmtNode>& __stmt);
+
+    // This function compiles an expression tree, leaving its result on
+    // top of the stack.
+    void compile_expr(node_idx __node);
+
+    // This function appends an instruction to the chunk and returns
+    // its index.
+    size_t emit(OPCODE_TYPE __op, size_t __a, size_t __b, size_t __col, size_t __lin);
+
+    // This function emits the release of a statement's scope at a
+    // given depth, given the size of _stores when the statement began.
+    void emit_release(size_t __depth, size_t __mark, size_t __col, size_t __lin);
+
+    // These functions return the index of a name or constant in the
+    // chunk, adding it if needed.
+    size_t add_name(const std::string& __name);
+    size_t add_const(const ParseNode& __node);
+
+    // These functions allocate a slot in the chunk's frame for every
+    // variable assigned within the given statements or expression.
+    // Nested function definitions are skipped, as they have their
+    // own frame.
+    void declare_slots(const std::vector<std::shared_ptr<StmtNode>>& __stmts);
+    void declare_slots(node_idx __node);
+
+    // This function allocates a new slot for a variable name.
+    size_t add_slot(const std::string& __name);
+
+    // This function resolves a variable name to its slot. Returns false
+    // if the name is not assigned within the chunk.
+    bool resolve_slot(const std::string& __name, size_t& __slot) const noexcept;
+
+    // This function returns the program-wide id of a symbol name.
+    size_t get_symbol(const std::string& __name);
+
+};
+
+/******************************************************************************/
+
+#endif // BYTECODE_COMPILER
+
+/******************************************************************************/
@@ -9,7 +9,7 @@
 //                              error occured on, and then terminates
 //                              the program with error status.
 //
-//  Dependencies:               None
+//  Dependencies:               output_handler.hpp
 //
 //  Classes:                    None
 //
@@ -28,6 +28,8 @@
 #include <string>                       // std::string
 #include <iostream>                     // std::cerr
 
+#include "output_handler.hpp"
+
 /******************************************************************************/
 
 // This enum contains the types of errors that can be thrown.
@@ -51,6 +53,7 @@ enum ERROR_TYPE {
     ERR_MISSING_BODY,
     ERR_MISSING_COND,
     ERR_BAD_COND_TYPE,
+    ERR_LIT_RANGE,
 
     // Evaluator errors.
     ERR_UNREC_SYM,
@@ -98,6 +101,7 @@ static std::vector<std::string> ERROR_STRINGS {
     "Missing statement body",
     "Expected condition before body",
     "Expected a boolean condition",
+    "Literal out of range",
 
     // Evaluator errors.
     "Unrecognized symbol",
@@ -128,7 +132,8 @@ static std::vector<std::string> ERROR_STRINGS {
 inline bool err_has_quotes(ERROR_TYPE __err) noexcept {
 
     return (__err == ERR_SYNTAX) || (__err == ERR_UNREC_SYM) ||
-           (__err == ERR_UNEXP_TOKEN) || (__err == ERR_INVALID_ESC_CHAR);
+           (__err == ERR_UNEXP_TOKEN) || (__err == ERR_INVALID_ESC_CHAR) ||
+           (__err == ERR_LIT_RANGE);
 
 }
 
@@ -140,6 +145,9 @@ inline bool err_has_quotes(ERROR_TYPE __err) noexcept {
 inline void throw_error(ERROR_TYPE __err, const std::string& __msg,
                         size_t __colnum, size_t __linenum) {
     
+    // Write out any buffered output first, so the error follows it.
+    flush_output();
+
     // Report the error.
     std::cerr << "Error [Line "<< __linenum << " Column " << __colnum << "]: ";
     std::cerr << ERROR_STRINGS[__err];
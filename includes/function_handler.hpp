@@ -12,6 +12,7 @@
 //                              as call functions within the table.
 //
 //  Dependencies:               all object definition files
+//                              compiler_utils.hpp
 //                              native_functions.hpp
 //                              native_member_functions.hpp
 //
@@ -30,12 +31,12 @@
 /******************************************************************************/
 
 #include <string>                           // std::string
-#include <map>                              // std::map
-#include <functional>                       // std::function
+#include <unordered_map>                    // std::unordered_map
 #include <vector>                           // std::vector
 #include <utility>                          // std::pair
 #include <memory>                           // std::shared_ptr
-#include <deque>                            // std::deque
+
+#include "utils/compiler_utils.hpp"
 
 #include "objects/rosky_interface.hpp"
 
@@ -56,18 +57,16 @@ struct UserFunction_T {
     // This holds the scope of the function.
     size_t _scope;
 
-    // This holds the start and end index in the token table
-    // of the function body.
-    size_t _start_idx;
-    size_t _end_idx;
+    // This holds the compiled chunk of the function body.
+    std::shared_ptr<Chunk_T> _chunk;
 
     // Ctor.
     UserFunction_T(const std::string& __func_name,
                    const std::vector<std::string>& __func_params,
                    size_t __scope,
-                   size_t __start_idx, size_t __end_idx)
+                   const std::shared_ptr<Chunk_T>& __chunk)
         : _func_name(__func_name), _func_params(__func_params),
-        _scope(__scope), _start_idx(__start_idx), _end_idx(__end_idx) {}
+        _scope(__scope), _chunk(__chunk) {}
 
 };
 
@@ -79,26 +78,43 @@ class FunctionTable_T {
 public:
 
     // Type definitions.
-    typedef std::shared_ptr<RoskyInterface>     obj;
+    typedef RoskyValue                          obj;
     typedef obj*                                obj_ptr;
     typedef std::pair<obj*, obj>                obj_pair;
 
+    typedef obj_pair (*native_func)(const std::vector<obj>&, size_t, size_t);
+    typedef obj_pair (*native_member_func)(obj_pair&, const std::vector<obj>&, size_t, size_t);
+
+    // This struct holds the function a call resolves to. At most one of
+    // the handles is set.
+    struct Callee_T {
+
+        native_func _native;
+        UserFunction_T* _user;
+
+    };
+
 private:
 
     // This is the built-in function table, which is a mapping of the name
-    // of the function to the function pointer along with the function
-    // call's metadata.
-    std::map<std::string, std::function<obj_pair(const std::vector<obj>&, size_t, size_t)>> _native_table;
+    // of the function to the function pointer.
+    std::unordered_map<std::string, native_func> _native_table;
 
     // This is the built-in member function table, which contains member
     // functions such as .append() or .size(). It takes in an object
     // pair as an argument so it knows the object that the member
     // function acts on.
-    std::map<std::string, std::function<obj_pair(obj_pair&, const std::vector<obj>&, size_t, size_t)>> _native_member_table;
+    std::unordered_map<std::string, native_member_func> _native_member_table;
 
-    // This is the user-defined function table, which is a deque of
-    // UserFunction_T shared pointers.
-    std::deque<std::shared_ptr<UserFunction_T>> _user_func_table;
+    // This is the user-defined function table. A user function cannot
+    // be redefined, and is never released once it is defined.
+    std::unordered_map<std::string, std::shared_ptr<UserFunction_T>> _user_func_table;
+
+    // The functions each symbol id has resolved to. As functions are
+    // never redefined, a resolved symbol keeps its handle, so a call
+    // only searches the tables until its function is found.
+    std::vector<Callee_T> _callees;
+    std::vector<native_member_func> _member_callees;
 
 public:
 
@@ -108,6 +124,7 @@ public:
         // Populate the function table with the built-in function pointers.
         _native_table["out"]    = out_func;
         _native_table["outln"]  = outln_func;
+        _native_table["flush"]  = flush_func;
         _native_table["scan"]   = scan_func;
         _native_table["assert"] = assert_func;
         _native_table["range"]  = range_func;
@@ -125,36 +142,23 @@ public:
     // table.
     bool is_function(const std::string& __func) const noexcept;
 
-    // This function calls a function from the table and returns the return value.
-    obj_pair call_function(const std::string& __func, const std::vector<obj>& __func_args,
-                           size_t __colnum, size_t __linenum);
-
     // This function returns true if a specified string is in the member function
     // table.
     bool is_member_function(const std::string& __func) const noexcept;
 
-    // This function calls a function from the member function table and returns
-    // the value.
-    obj_pair call_member_function(const std::string& __func,
-                                  obj_pair& __obj,
-                                  const std::vector<obj>& __func_args,
-                                  size_t __colnum, size_t __linenum);
-
     // This function adds a new user function to the user function table.
     void add_user_function(const std::string& __func,
                            const std::vector<std::string>& __func_params,
-                           size_t __scope, size_t __start_idx, size_t __end_idx) noexcept;
+                           size_t __scope, const std::shared_ptr<Chunk_T>& __chunk) noexcept;
 
     // This function returns true if a specified string is in the user function
     // table.
     bool is_user_function(const std::string& __func) const noexcept;
 
-    // This function returns an entry in the user function table.
-    std::shared_ptr<UserFunction_T> get_user_function(const std::string& __func) const noexcept;
-
-    // This function releases all user function above and including a given
-    // scope.
-    void release_above_scope(size_t __scope) noexcept;
+    // These functions resolve the function or member function a symbol
+    // id names. The handles are nullptr if there is no such function.
+    Callee_T resolve(size_t __symbol, const std::string& __func) noexcept;
+    native_member_func resolve_member(size_t __symbol, const std::string& __func) noexcept;
 
 };
 
@@ -9,6 +9,7 @@
 //
 //  Dependencies:               all object definition files
 //                              error_handler.hpp
+//                              output_handler.hpp
 //
 //  Classes:                    None
 //
@@ -16,6 +17,7 @@
 //
 //  Exported Subprograms:       out
 //                              outln
+//                              flush
 //                              scan
 //                              assert
 //                              
@@ -35,53 +37,62 @@
 #include "../objects/rosky_interface.hpp"
 #include "../objects/rosky_null.hpp"
 #include "../objects/rosky_group.hpp"
+#include "../objects/rosky_range.hpp"
 #include "../objects/rosky_int.hpp"
 #include "../objects/rosky_string.hpp"
 
 #include "../error_handler.hpp"
+#include "../output_handler.hpp"
 
 /******************************************************************************/
 
 // This function outputs an object to the standard output.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    out_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    out_func(const std::vector<RoskyValue>& __func_args,
              size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
 
 // This function outputs an object to the standard output and inserts
 // a new line after.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    outln_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    outln_func(const std::vector<RoskyValue>& __func_args,
+               size_t __colnum, size_t __linenum);
+
+/******************************************************************************/
+
+// This function writes out the buffered standard output.
+std::pair<RoskyValue*, RoskyValue>
+    flush_func(const std::vector<RoskyValue>& __func_args,
                size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
 
 // This function gets a string from stdin.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    scan_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    scan_func(const std::vector<RoskyValue>& __func_args,
                size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
 
 // This function takes in a boolean expression and throws an assertion error
 // if the condition is false.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    assert_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    assert_func(const std::vector<RoskyValue>& __func_args,
                 size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
 
 // This function generates a group of integers in a given range.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    range_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    range_func(const std::vector<RoskyValue>& __func_args,
                 size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
 
 // This function returns a string of the provided object type.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    type_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    type_func(const std::vector<RoskyValue>& __func_args,
                 size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
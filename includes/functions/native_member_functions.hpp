@@ -32,17 +32,17 @@
 /******************************************************************************/
 
 // This function returns the size of an iterable.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    size_func(std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>& __obj,
-               const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    size_func(std::pair<RoskyValue*, RoskyValue>& __obj,
+               const std::vector<RoskyValue>& __func_args,
                size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
 
 // This function appends an object to an iterable.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    append_func(std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>& __obj,
-               const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    append_func(std::pair<RoskyValue*, RoskyValue>& __obj,
+               const std::vector<RoskyValue>& __func_args,
                size_t __colnum, size_t __linenum);
 
 /******************************************************************************/
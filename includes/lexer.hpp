@@ -14,12 +14,11 @@
 //                              making logical or syntactic sense of the
 //                              source.
 //
-//                              After the table is created, it will be
-//                              fed into the parser.
+//                              After the table is created, it is returned
+//                              to be fed into the parser.
 //
 //  Dependencies:               source_handler.hpp
 //                              error_handler.hpp
-//                              parser.hpp
 //                              lexer_utils.hpp
 //
 //  Classes:                    None
@@ -41,8 +40,6 @@
 
 #include "source_handler.hpp"
 #include "error_handler.hpp"
-#include "parser.hpp"
-#include "variable_handler.hpp"
 
 #include "utils/lexer_utils.hpp"
 
@@ -50,7 +47,7 @@
 
 // This function is responsible for converting a formatted source
 // into a table of tokens for parsing.
-void tokenize_src(std::unique_ptr<Src_T>& __src);
+TokenTable_T tokenize_src(std::unique_ptr<Src_T>& __src);
 
 /******************************************************************************/
 
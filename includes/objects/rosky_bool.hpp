@@ -6,7 +6,8 @@
 //  Description:                This file contains the class definition for
 //                              the built in boolean type.
 // 
-//                              The underlying data type is a bool
+//                              The underlying data type is a bool. It is
+//                              stored inline in a RoskyValue.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -68,17 +69,17 @@ public:
     bool to_bool() const noexcept override;
 
     // String operators.
-    std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept override;
     
     // Comparison operators.
-    std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept override;
 
     // Boolean operators.
-    std::shared_ptr<RoskyInterface> not_op() const noexcept override;
-    std::shared_ptr<RoskyInterface> and_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> xor_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> or_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue not_op() const noexcept override;
+    RoskyValue and_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue xor_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue or_op(const RoskyValue& __r) const noexcept override;
 
 };
 
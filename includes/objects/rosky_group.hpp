@@ -6,11 +6,21 @@
 //  Description:                This file contains the class definition for
 //                              the built in group type.
 // 
-//                              The underlying data type is a deque.
+//                              The underlying data type is a deque, held
+//                              in a storage block that groups with the
+//                              same elements share. A shared block is
+//                              copied before it is written to.
+//
+//                              Once the address of an element is handed
+//                              out, the block is pinned to its group and
+//                              is copied rather than shared, as a write
+//                              through the address would otherwise reach
+//                              every group sharing it.
 //
 //  Dependencies:               RoskyInterface
 //
-//  Classes:                    RoskyGroup
+//  Classes:                    RoskyGroupData
+//                              RoskyGroup
 //
 //  Inherited Subprograms:      get_type_id
 //                              get_type_string
@@ -21,6 +31,8 @@
 //
 //  Exported Subprograms:       ctor
 //                              ctor(deque)
+//                              ctor(block)
+//                              share_block
 //                              
 /******************************************************************************/
 
@@ -37,19 +49,54 @@
 
 /******************************************************************************/
 
+// This is the class definition for the storage block of a group's
+// elements.
+class RoskyGroupData : public RoskyBox {
+
+public:
+
+    std::deque<RoskyValue> _elems;
+
+    // Constructors.
+    RoskyGroupData(std::deque<RoskyValue>&& __elems) : _elems(std::move(__elems)) {}
+
+};
+
+/******************************************************************************/
+
 // This is the class defintion for the RoskyGroup class.
 class RoskyGroup : public RoskyInterface {
 
 private:
 
-    // The underlying data type is a deque.
-    std::deque<std::shared_ptr<RoskyInterface>> _data;
+    // The storage block of the elements.
+    RoskyRef _block;
+
+    // Whether the block is pinned to the group.
+    bool _pinned;
+
+protected:
+
+    // These functions return the elements. The elements to be written
+    // to are copied into a new block first if the block is shared.
+    const std::deque<RoskyValue>& data() const noexcept {
+        return static_cast<const RoskyGroupData*>(_block.get())->_elems;
+    }
+
+    std::deque<RoskyValue>& write_data() noexcept;
 
 public:
 
-    // Constructors.
-    RoskyGroup() : _data(0) {}
-    RoskyGroup(const std::deque<std::shared_ptr<RoskyInterface>>& __data) : _data(__data) {}
+    // Constructors. A group constructed from a block shares it.
+    RoskyGroup() : RoskyGroup(std::deque<RoskyValue>()) {}
+    RoskyGroup(const std::deque<RoskyValue>& __data) : RoskyGroup(std::deque<RoskyValue>(__data)) {}
+    RoskyGroup(std::deque<RoskyValue>&& __data)
+        : _block(new RoskyGroupData(std::move(__data))), _pinned(false) {}
+    RoskyGroup(RoskyRef&& __block) : _block(std::move(__block)), _pinned(false) {}
+
+    // This function returns a block of the elements for a new group to
+    // share. A pinned block is copied.
+    virtual RoskyRef share_block() const;
 
     // Destrcutor.
     ~RoskyGroup() {}
@@ -66,23 +113,28 @@ public:
     long to_int() const noexcept override;
     std::string to_string() const noexcept override;
     bool to_bool() const noexcept override;
-    std::deque<std::shared_ptr<RoskyInterface>> to_group() const noexcept override;
+    std::deque<RoskyValue> to_group() const noexcept override;
 
     // Arithmetic operators.
-    std::shared_ptr<RoskyInterface> add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue add_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue mul_op(const RoskyValue& __r) const noexcept override;
 
     // String operators.
-    std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept override;
 
     // Comparison operators.
-    std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept override;
 
     // Iterable functionality.
     size_t get_size() const noexcept override;
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> index_op(const std::shared_ptr<RoskyInterface>& __r) noexcept override;
-    void append_func(const std::shared_ptr<RoskyInterface>& __r) noexcept override;
+    RoskyValue element_at(size_t __pos) const noexcept override;
+    std::pair<RoskyValue*, RoskyValue> index_op(const RoskyValue& __r) noexcept override;
+    void append_func(const RoskyValue& __r) noexcept override;
+
+    // Iteration.
+    bool done(size_t __pos) const noexcept override;
+    RoskyValue next(size_t& __pos) const noexcept override;
 
 };
 
@@ -7,7 +7,9 @@
 //                              the built in integer type.
 // 
 //                              The underlying data type is a long, rather
-//                              than an int.
+//                              than an int. Integers are stored inline
+//                              in a RoskyValue, which only constructs a
+//                              RoskyInt to apply an operator.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -71,23 +73,23 @@ public:
     bool to_bool() const noexcept override;
 
     // Arithmetic operators.
-    std::shared_ptr<RoskyInterface> add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> sub_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> div_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> idiv_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> mod_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue add_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue sub_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue mul_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue div_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue idiv_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue mod_op(const RoskyValue& __r) const noexcept override;
 
     // String operators.
-    std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept override;
 
     // Comparison operators.
-    std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> gt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> lt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> geq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> leq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue gt_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue lt_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue geq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue leq_op(const RoskyValue& __r) const noexcept override;
 
 };
 
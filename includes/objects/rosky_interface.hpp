@@ -6,7 +6,13 @@
 //  Description:                This file contains the interface for all
 //                              built-in objects to inherit from.
 //
-//  Dependencies:               None
+//                              Objects are held in a RoskyValue, which
+//                              boxes them if their type is not stored
+//                              inline. Boxed objects are formed in the
+//                              pools with make_object, and the box header
+//                              counts their references.
+//
+//  Dependencies:               RoskyValue
 //
 //  Classes:                    RoskyInterface
 //
@@ -26,30 +32,16 @@
 
 /******************************************************************************/
 
-#include <memory>                   // std::shared_ptr
 #include <string>                   // std::string
 #include <utility>                  // std::pair
 #include <deque>                    // std::deque
 
-/******************************************************************************/
-
-// This enum defines the built-in object types.
-enum OBJ_TYPES {
-
-    OBJ_INT,
-    OBJ_POINTER,
-    OBJ_NULL,
-    OBJ_STRING,
-    OBJ_BOOL,
-    OBJ_GROUP,
-    OBJ_FLOAT,
-
-};
+#include "rosky_value.hpp"
 
 /******************************************************************************/
 
 // This is the class definition for the RoskyInterface class.
-class RoskyInterface {
+class RoskyInterface : public RoskyBox {
 
 public:
 
@@ -68,45 +60,59 @@ public:
     virtual long to_int() const noexcept { return 0; }
     virtual double to_float() const noexcept { return 0.0; }
     virtual std::string to_string() const noexcept = 0;
-    virtual std::shared_ptr<RoskyInterface>* to_pointer() const noexcept { return nullptr; }
+    virtual RoskyValue* to_pointer() const noexcept { return nullptr; }
     virtual bool to_bool() const noexcept = 0;
-    virtual std::deque<std::shared_ptr<RoskyInterface>> to_group() const noexcept { return {}; }
+    virtual std::deque<RoskyValue> to_group() const noexcept { return {}; }
     
     // Arithmetic operators.
-    virtual std::shared_ptr<RoskyInterface> add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> sub_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> div_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> idiv_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> mod_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
+    virtual RoskyValue add_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue sub_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue mul_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue div_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue idiv_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue mod_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
 
     // Pointer operators.
-    virtual std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> deref_op() const noexcept { return {nullptr, nullptr}; }
+    virtual std::pair<RoskyValue*, RoskyValue> deref_op() const noexcept { return {nullptr, RoskyValue()}; }
 
     // String operators.
-    virtual std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
+    virtual RoskyValue concat_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
 
     // Comparison operators.
-    virtual std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> gt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> lt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> geq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> leq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
+    virtual RoskyValue eq_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue neq_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue gt_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue lt_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue geq_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue leq_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
 
     // Boolean operators.
-    virtual std::shared_ptr<RoskyInterface> not_op() const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> and_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> xor_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
-    virtual std::shared_ptr<RoskyInterface> or_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept { return nullptr; }
+    virtual RoskyValue not_op() const noexcept { return RoskyValue(); }
+    virtual RoskyValue and_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue xor_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
+    virtual RoskyValue or_op(const RoskyValue& __r) const noexcept { return RoskyValue(); }
 
-    // Iterable functionality.
+    // Iterable functionality. The element at a position below the size
+    // is returned without copying the object's elements.
     virtual size_t get_size() const noexcept { return 0; }
-    virtual std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> index_op(const std::shared_ptr<RoskyInterface>& __r) noexcept { return {nullptr, nullptr}; }
-    virtual void append_func(const std::shared_ptr<RoskyInterface>& __r) noexcept {}
+    virtual RoskyValue element_at(size_t __pos) const noexcept { return RoskyValue(); }
+    virtual std::pair<RoskyValue*, RoskyValue> index_op(const RoskyValue& __r) noexcept { return {nullptr, RoskyValue()}; }
+    virtual void append_func(const RoskyValue& __r) noexcept {}
+
+    // Iteration. An iteration holds the position of the next element,
+    // which next returns and advances past until the object is done.
+    virtual size_t begin() const noexcept { return 0; }
+    virtual bool done(size_t __pos) const noexcept { return true; }
+    virtual RoskyValue next(size_t& __pos) const noexcept { return RoskyValue(); }
 
 };
 
 /******************************************************************************/
 
+inline RoskyInterface* RoskyValue::get_box() const noexcept {
+    return static_cast<RoskyInterface*>(_obj.get());
+}
+
+/******************************************************************************/
+
 #endif // ROSKY_INTERFACE
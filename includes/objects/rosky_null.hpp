@@ -7,7 +7,8 @@
 //                              the built in null type.
 // 
 //                              There is no underlying data type for this
-//                              class.
+//                              class. Null values are stored inline in
+//                              a RoskyValue.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -60,11 +61,11 @@ public:
     bool to_bool() const noexcept override;
 
     // String operators.
-    std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept override;
 
     // Comparison operators.
-    std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept override;
 
 };
 
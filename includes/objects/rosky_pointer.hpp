@@ -7,7 +7,8 @@
 //                              the built in pointer type.
 // 
 //                              The underlying data type is a pointer
-//                              to a shared_ptr instance of an object.
+//                              to the value of a variable or group
+//                              element.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -46,15 +47,15 @@ class RoskyPointer : public RoskyInterface {
 
 private:
 
-    // The underlying data type is a pointer to a shared_ptr
-    // instance of an object.
-    std::shared_ptr<RoskyInterface>* _data;
+    // The underlying data type is a pointer to the value of a
+    // variable or group element.
+    RoskyValue* _data;
 
 public:
 
     // Constructors.
     RoskyPointer() : _data(nullptr) {}
-    RoskyPointer(std::shared_ptr<RoskyInterface>* __data)
+    RoskyPointer(RoskyValue* __data)
         : _data(__data) {}
 
     // Destructor.
@@ -71,18 +72,18 @@ public:
     // Casting.
     long to_int() const noexcept override;
     std::string to_string() const noexcept override;
-    std::shared_ptr<RoskyInterface>* to_pointer() const noexcept override;
+    RoskyValue* to_pointer() const noexcept override;
     bool to_bool() const noexcept override;
 
     // Pointer operators.
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> deref_op() const noexcept override;
+    std::pair<RoskyValue*, RoskyValue> deref_op() const noexcept override;
 
     // String operators.
-    std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept override;
 
     // Comparison operators.
-    std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept override;
 
 };
 
@@ -0,0 +1,99 @@
+
+/******************************************************************************/
+//
+//  Source Name:                rosky_range.hpp
+//
+//  Description:                This file contains the class definition for
+//                              the group returned by the range function.
+//
+//                              Its elements are computed from the start,
+//                              step and size on demand. The group is only
+//                              stored once an element is addressed or
+//                              appended, after which it behaves as a
+//                              regular group.
+//
+//  Dependencies:               RoskyGroup
+//
+//  Classes:                    RoskyRange
+//
+//  Inherited Subprograms:      get_type_id
+//                              get_type_string
+//                              is_iterable
+//                              is_addressable
+//                              to_int
+//                              to_string
+//                              to_bool
+//                              add_op
+//                              mul_op
+//                              concat_op
+//                              eq_op
+//                              neq_op
+//
+//  Exported Subprograms:       ctor(start, end, step)
+//
+/******************************************************************************/
+
+#ifndef ROSKY_RANGE
+#define ROSKY_RANGE
+
+/******************************************************************************/
+
+#include <string>                           // std::string
+
+#include "rosky_interface.hpp"
+#include "rosky_group.hpp"
+
+/******************************************************************************/
+
+// This is the class defintion for the RoskyRange class.
+class RoskyRange : public RoskyGroup {
+
+private:
+
+    // The first element, and the difference between elements.
+    long _start;
+    long _step;
+
+    // The number of elements while the group is not stored.
+    size_t _size;
+
+    // Whether the elements have been stored in the group's deque.
+    bool _stored;
+
+    // This function stores the elements in the group's deque.
+    void store() noexcept;
+
+public:
+
+    // Constructors. The step must be positive.
+    RoskyRange(long __start, long __end, long __step)
+        : _start(__start), _step(__step),
+        _size(__end > __start ? (__end - __start + __step - 1) / __step : 0),
+        _stored(false) {}
+
+    // Destructor.
+    ~RoskyRange() {}
+
+    // Casting.
+    std::deque<RoskyValue> to_group() const noexcept override;
+
+    // Sharing. The block is formed if the group is not stored.
+    RoskyRef share_block() const override;
+
+    // Iterable functionality.
+    size_t get_size() const noexcept override;
+    RoskyValue element_at(size_t __pos) const noexcept override;
+    std::pair<RoskyValue*, RoskyValue> index_op(const RoskyValue& __r) noexcept override;
+    void append_func(const RoskyValue& __r) noexcept override;
+
+    // Iteration.
+    bool done(size_t __pos) const noexcept override;
+    RoskyValue next(size_t& __pos) const noexcept override;
+
+};
+
+/******************************************************************************/
+
+#endif // ROSKY_RANGE
+
+/******************************************************************************/
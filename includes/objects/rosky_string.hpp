@@ -31,6 +31,7 @@
 
 #include <string>                       // std::string
 #include <memory>                       // std::shared_ptr
+#include <utility>                      // std::move
 
 #include "rosky_interface.hpp"
 #include "rosky_bool.hpp"
@@ -50,6 +51,7 @@ public:
     // Ctors.
     RoskyString() : _data("") {}
     RoskyString(const std::string& __data) : _data(__data) {}
+    RoskyString(std::string&& __data) : _data(std::move(__data)) {}
 
     // Dtor.
     ~RoskyString() {}
@@ -68,19 +70,23 @@ public:
     bool to_bool() const noexcept override;
 
     // Arithmetic operators.
-    std::shared_ptr<RoskyInterface> add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue add_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue mul_op(const RoskyValue& __r) const noexcept override;
 
     // String operators.
-    std::shared_ptr<RoskyInterface> concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept override;
     
     // Comparison operators.
-    std::shared_ptr<RoskyInterface> eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
-    std::shared_ptr<RoskyInterface> neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept override;
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept override;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept override;
 
     // Iterable functionality.
     size_t get_size() const noexcept override;
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> index_op(const std::shared_ptr<RoskyInterface>& __r) noexcept override;
+    std::pair<RoskyValue*, RoskyValue> index_op(const RoskyValue& __r) noexcept override;
+
+    // Iteration.
+    bool done(size_t __pos) const noexcept override;
+    RoskyValue next(size_t& __pos) const noexcept override;
 
 };
 
@@ -0,0 +1,324 @@
+
+/******************************************************************************/
+//
+//  Source Name:                rosky_value.hpp
+//
+//  Description:                This file contains the class definition for
+//                              the value every variable, group element
+//                              and operand holds.
+//
+//                              Integers, floats, booleans and null are
+//                              stored inline in the value. Strings, groups
+//                              and pointers are boxed in a RoskyInterface
+//                              object that the value shares ownership of.
+//
+//                              Every box counts the references to it in
+//                              its header, and is freed to the pools when
+//                              the last one is released. The interpreter
+//                              is single threaded, so the count is not
+//                              atomic and copying a value is a plain
+//                              increment.
+//
+//                              A value can also be empty, which denotes an
+//                              unbound variable or an incompatible
+//                              operation.
+//
+//                              Boxed objects are never modified once
+//                              formed, except for groups. So nullptr,
+//                              the empty string and the single character
+//                              strings each have one shared box, formed
+//                              on first use.
+//
+//  Dependencies:               pool_handler.hpp
+//
+//  Classes:                    RoskyBox
+//                              RoskyRef
+//                              RoskyValue
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       ctor
+//                              ctor(obj)
+//                              make_int
+//                              make_float
+//                              make_bool
+//                              make_null
+//                              make_nullptr
+//                              make_string
+//                              is_empty
+//                              get_type_id
+//                              get_box
+//                              make_object
+//
+/******************************************************************************/
+
+#ifndef ROSKY_VALUE
+#define ROSKY_VALUE
+
+/******************************************************************************/
+
+#include <string>                   // std::string
+#include <utility>                  // std::pair, std::forward
+#include <deque>                    // std::deque
+
+#include "../pool_handler.hpp"
+
+/******************************************************************************/
+
+// This enum defines the built-in object types.
+enum OBJ_TYPES {
+
+    OBJ_INT,
+    OBJ_POINTER,
+    OBJ_NULL,
+    OBJ_STRING,
+    OBJ_BOOL,
+    OBJ_GROUP,
+    OBJ_FLOAT,
+
+    // The type of an empty value.
+    OBJ_NONE,
+
+};
+
+/******************************************************************************/
+
+class RoskyInterface;
+
+// This is the class definition for the RoskyBox class, the header of
+// every boxed object. Boxes are allocated from the pools, and a box's
+// size is that of the derived object when it is freed.
+class RoskyBox {
+
+private:
+
+    friend class RoskyRef;
+
+    // The number of references to the box.
+    size_t _refs = 0;
+
+public:
+
+    // Constructors. A copy is a new box, with no references to it yet.
+    RoskyBox() noexcept {}
+    RoskyBox(const RoskyBox&) noexcept {}
+    RoskyBox& operator=(const RoskyBox&) noexcept { return *this; }
+
+    // Virtual destructor.
+    virtual ~RoskyBox() {}
+
+    // Allocation.
+    static void* operator new(size_t __size) { return pool_alloc(__size); }
+    static void operator delete(void* __ptr, size_t __size) noexcept { pool_free(__ptr, __size); }
+
+};
+
+/******************************************************************************/
+
+// This is the class definition for the RoskyRef class, a reference to
+// a box that shares ownership of it.
+class RoskyRef {
+
+private:
+
+    RoskyBox* _box;
+
+public:
+
+    // Constructors.
+    RoskyRef() noexcept : _box(nullptr) {}
+
+    explicit RoskyRef(RoskyBox* __box) noexcept : _box(__box) {
+        retain();
+    }
+
+    RoskyRef(const RoskyRef& __r) noexcept : _box(__r._box) {
+        retain();
+    }
+
+    RoskyRef(RoskyRef&& __r) noexcept : _box(__r._box) {
+        __r._box = nullptr;
+    }
+
+    // Destructor.
+    ~RoskyRef() { release(); }
+
+    // Assignment. The source is taken before the old box is released,
+    // as releasing it may free the source.
+    RoskyRef& operator=(const RoskyRef& __r) noexcept {
+        RoskyBox* box = __r._box;
+        if (box != nullptr) {
+            box->_refs++;
+        }
+        release();
+        _box = box;
+        return *this;
+    }
+
+    RoskyRef& operator=(RoskyRef&& __r) noexcept {
+        RoskyBox* box = __r._box;
+        __r._box = nullptr;
+        release();
+        _box = box;
+        return *this;
+    }
+
+    RoskyBox* get() const noexcept { return _box; }
+
+    // Whether another reference shares the box.
+    bool is_shared() const noexcept { return _box != nullptr && _box->_refs > 1; }
+
+private:
+
+    void retain() noexcept {
+        if (_box != nullptr) {
+            _box->_refs++;
+        }
+    }
+
+    void release() noexcept {
+        if (_box != nullptr && --_box->_refs == 0) {
+            delete _box;
+        }
+    }
+
+};
+
+/******************************************************************************/
+
+// This is the class definition for the RoskyValue class.
+class RoskyValue {
+
+private:
+
+    // The type of the value.
+    OBJ_TYPES _type;
+
+    // The inline data of an int, float or bool.
+    union {
+        long _int;
+        double _float;
+        bool _bool;
+    };
+
+    // The boxed object of a string, group or pointer.
+    RoskyRef _obj;
+
+public:
+
+    // Constructors. A value constructed from an object boxes it.
+    RoskyValue() noexcept : _type(OBJ_NONE), _int(0) {}
+
+    template <typename T>
+    explicit RoskyValue(T* __obj) noexcept
+        : _type(__obj->get_type_id()), _int(0), _obj(__obj) {}
+
+    // Factories of the inline types.
+    static RoskyValue make_int(long __data) noexcept {
+        RoskyValue v(OBJ_INT);
+        v._int = __data;
+        return v;
+    }
+
+    static RoskyValue make_float(double __data) noexcept {
+        RoskyValue v(OBJ_FLOAT);
+        v._float = __data;
+        return v;
+    }
+
+    static RoskyValue make_bool(bool __data) noexcept {
+        RoskyValue v(OBJ_BOOL);
+        v._bool = __data;
+        return v;
+    }
+
+    static RoskyValue make_null() noexcept {
+        return RoskyValue(OBJ_NULL);
+    }
+
+    // Factories of the boxed immutable types, which return the shared
+    // box where there is one.
+    static RoskyValue make_nullptr() noexcept;
+    static RoskyValue make_string(std::string __data) noexcept;
+
+    // Type information.
+    bool is_empty() const noexcept { return _type == OBJ_NONE; }
+    OBJ_TYPES get_type_id() const noexcept { return _type; }
+
+    // The boxed object, or nullptr for an inline type. This is defined
+    // with RoskyInterface.
+    inline RoskyInterface* get_box() const noexcept;
+
+    std::string get_type_string() const noexcept;
+
+    // Iterable information.
+    bool is_iterable() const noexcept;
+    bool is_addressable() const noexcept;
+
+    // Casting.
+    long to_int() const noexcept;
+    double to_float() const noexcept;
+    std::string to_string() const noexcept;
+    RoskyValue* to_pointer() const noexcept;
+    bool to_bool() const noexcept;
+    std::deque<RoskyValue> to_group() const noexcept;
+
+    // Arithmetic operators.
+    RoskyValue add_op(const RoskyValue& __r) const noexcept;
+    RoskyValue sub_op(const RoskyValue& __r) const noexcept;
+    RoskyValue mul_op(const RoskyValue& __r) const noexcept;
+    RoskyValue div_op(const RoskyValue& __r) const noexcept;
+    RoskyValue idiv_op(const RoskyValue& __r) const noexcept;
+    RoskyValue mod_op(const RoskyValue& __r) const noexcept;
+
+    // Pointer operators.
+    std::pair<RoskyValue*, RoskyValue> deref_op() const noexcept;
+
+    // String operators.
+    RoskyValue concat_op(const RoskyValue& __r) const noexcept;
+
+    // Comparison operators.
+    RoskyValue eq_op(const RoskyValue& __r) const noexcept;
+    RoskyValue neq_op(const RoskyValue& __r) const noexcept;
+    RoskyValue gt_op(const RoskyValue& __r) const noexcept;
+    RoskyValue lt_op(const RoskyValue& __r) const noexcept;
+    RoskyValue geq_op(const RoskyValue& __r) const noexcept;
+    RoskyValue leq_op(const RoskyValue& __r) const noexcept;
+
+    // Boolean operators.
+    RoskyValue not_op() const noexcept;
+    RoskyValue and_op(const RoskyValue& __r) const noexcept;
+    RoskyValue xor_op(const RoskyValue& __r) const noexcept;
+    RoskyValue or_op(const RoskyValue& __r) const noexcept;
+
+    // Iterable functionality.
+    size_t get_size() const noexcept;
+    std::pair<RoskyValue*, RoskyValue> index_op(const RoskyValue& __r) const noexcept;
+    void append_func(const RoskyValue& __r) const noexcept;
+
+private:
+
+    // This constructor makes a value of an inline type.
+    explicit RoskyValue(OBJ_TYPES __type) noexcept : _type(__type), _int(0) {}
+
+    // This function calls __f on the object the value holds. The object
+    // of an inline type is constructed on the stack for the call.
+    template <typename F>
+    auto dispatch(F __f) const noexcept;
+
+};
+
+/******************************************************************************/
+
+// This function forms a boxed runtime object in the pools. Every boxed
+// object is created through it.
+template <typename T, typename... Args>
+inline RoskyValue make_object(Args&&... __args) {
+    return RoskyValue(new T(std::forward<Args>(__args)...));
+}
+
+/******************************************************************************/
+
+#endif // ROSKY_VALUE
+
+/******************************************************************************/
@@ -0,0 +1,50 @@
+/******************************************************************************/
+//
+//  Source Name:                output_handler.hpp
+//
+//  Description:                This file is responsible for buffering
+//                              the program's standard output, so that
+//                              printing does not cost a write per call.
+//
+//                              The buffer is written out when it fills,
+//                              at exit, before an error is reported, when
+//                              stdin is read, and on an explicit flush.
+//                              If stdout is a terminal, it is also written
+//                              out at the end of every line.
+//
+//  Dependencies:               None
+//
+//  Classes:                    None
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       write_output
+//                              flush_output
+//
+/******************************************************************************/
+
+#ifndef OUTPUT_HANDLER
+#define OUTPUT_HANDLER
+
+/******************************************************************************/
+
+#include <string>                       // std::string
+
+/******************************************************************************/
+
+// The size of the standard output buffer in bytes.
+#define OUTPUT_BUFFER_SIZE 65536
+
+/******************************************************************************/
+
+// This function appends a string to the standard output buffer.
+void write_output(const std::string& __str);
+
+// This function writes the buffered output to stdout.
+void flush_output();
+
+/******************************************************************************/
+
+#endif // OUTPUT_HANDLER
+
+/******************************************************************************/
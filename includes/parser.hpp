@@ -1,4 +1,3 @@
-
 /******************************************************************************/
 //
 //  Source Name:                parser.hpp
@@ -10,19 +9,14 @@
 //                              parsing is handled in specific parse functions
 //                              pertaining to the tokens needing to be parsed.
 // 
-//                              The parser will catch logical as well as
-//                              syntactical errors.
-//
-//                              This file also owns the instance
-//                              of the variable handler backend.
+//                              The parser will catch syntactical errors
+//                              and forms the token table into a tree of
+//                              statement and expression nodes, which is
+//                              built once and handed to the executor.
 //
 //  Dependencies:               lexer_utils.hpp
 //                              parser_utils.hpp
 //                              error_handler.hpp
-//                              evaluator.hpp
-//                              variable_handler.hpp
-//                              function_handler.hpp
-//                              rosky_interface.hpp
 //
 //  Classes:                    Parser_T
 //
@@ -40,143 +34,135 @@
 /******************************************************************************/
 
 #include <deque>                        // std::deque
-#include <memory>                       // std::shared_ptr, std::unique_ptr
-#include <utility>                      // std::pair
+#include <memory>                       // std::shared_ptr
 #include <vector>                       // std::vector
 
 #include "utils/lexer_utils.hpp"
 #include "utils/parser_utils.hpp"
 
 #include "error_handler.hpp"
-#include "evaluator.hpp"
-#include "variable_handler.hpp"
-#include "function_handler.hpp"
-
-#include "objects/rosky_interface.hpp"
-#include "objects/rosky_null.hpp"
 
 /******************************************************************************/
 
 // This class provides the definition for the parser object. It holds
-// instances the different components it needs to reference so that the
-// instances don't need to be passed to each seperate function of the
-// parser.
+// the token table and the state needed to validate statements that
+// are only legal in certain contexts, so that these don't need to be
+// passed to each seperate function of the parser.
 class Parser_T {
 
 private:
 
     // The token table object.
-    std::deque<std::shared_ptr<Token_T>> _tokens;
-
-    // The variable table handler instance.
-    std::unique_ptr<VariableTable_T> _var_table;
+    const TokenTable_T& _tokens;
 
-    // The function table handler instance.
-    std::unique_ptr<FunctionTable_T> _func_table;
+    // The lookup tables of the token table.
+    TokenIndex_T _index;
 
-    // This tracks the recursive index we are currently parsing at.
-    // This is the depth of recursive function calls.
-    size_t _recursive_index;
-
-    // This flag defines whether we are currently in a loop.
+    // This flag defines whether we are currently parsing a loop body.
     bool _loop_flag;
 
-    // This flag defines whether we have encountered a loop break.
-    bool _break_flag;
-
-    // This flag defines whether we have encountered a loop continue.
-    bool _cont_flag;
-
-    // This flag defines whether we are currently in a function.
+    // This flag defines whether we are currently parsing a function body.
     bool _func_flag;
 
-    // This flag defines whether we have encountered a function return.
-    bool _return_flag;
+    // The arena expressions are currently built in. Each function body
+    // gets its own.
+    std::shared_ptr<ExprArena_T> _arena;
 
-    // This object is the return objects from functions.
-    std::shared_ptr<RoskyInterface> _parser_ret_obj;
+    // The roots of the arguments of the calls and groups being parsed.
+    std::vector<node_idx> _arg_stack;
 
 public:
 
     // Ctor.
-    Parser_T(const std::deque<std::shared_ptr<Token_T>>& __tokens)
-        : _tokens(__tokens), _recursive_index(0),
-        _loop_flag(false), _break_flag(false), _cont_flag(false),
-        _func_flag(false), _return_flag(false), _parser_ret_obj(nullptr) {
-        
-        // Instantiate the variable handler.
-        _var_table = std::make_unique<VariableTable_T>();
-
-        // Instantiate the function handler.
-        _func_table = std::make_unique<FunctionTable_T>();
-
-    }
+    Parser_T(const TokenTable_T& __tokens)
+        : _tokens(__tokens), _index(index_tokens(__tokens)),
+          _loop_flag(false), _func_flag(false),
+          _arena(std::make_shared<ExprArena_T>()) {}
+
+    // This function returns the arena of the expressions outside of any
+    // function body.
+    const std::shared_ptr<ExprArena_T>& get_arena() const noexcept { return _arena; }
     
     // This function is the main 'brain' of the parser. It will look through
     // a provided token table and dispatch specialized parse functions based on
-    // the tokens it encounters.
-    void parse(size_t __start_idx, size_t __end_idx, size_t __scope);
+    // the tokens it encounters. It returns the statements found in the range.
+    std::vector<std::shared_ptr<StmtNode>> parse(size_t __start_idx, size_t __end_idx);
 
     // The following functions are defined in external files from
     // the parser.cpp
 
     // This function is for parsing expressions. It forms the tokens into
-    // an expression tree, and upon success feeds the tree into the evaluator
-    // to get the result.
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-        parse_expr(size_t& __idx, size_t __end_idx, size_t __scope);
+    // an expression tree in the current arena and returns the root of the tree.
+    node_idx parse_expr(size_t& __idx, size_t __end_idx);
 
     // This is a helper function for parsing function arguments.
-    std::vector<std::shared_ptr<RoskyInterface>>
-        parse_func_args(size_t& __idx, size_t __end_idx, size_t __scope);
+    void parse_func_args(node_idx __node, size_t& __idx, size_t __end_idx);
 
-    // This function is for parsing function calls. It forms objects from the
-    // arguments and calls upon the function handler to evaluate the
-    // provided function along with its arguments.
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-        parse_func(size_t& __idx, size_t __end_idx, size_t __scope);
+    // This function is for parsing function calls. It forms a call node
+    // holding the expression trees of the arguments.
+    node_idx parse_func(size_t& __idx, size_t __end_idx);
 
-    // This function is for parsing member function calls. It forms objects
-    // from the arguments and calls the function handler.
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-        parse_member_func(std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> __obj,
-                          size_t& __idx, size_t __end_idx, size_t __scope);
+    // This function is for parsing member function calls. It forms a member
+    // call node on the provided object node.
+    node_idx parse_member_func(node_idx __obj, size_t& __idx, size_t __end_idx);
 
     // This function is for parsing user defined function definitions starting
     // with the keyword 'func'.
-    void parse_func_def(size_t& __idx, size_t __end_idx, size_t __scope);
+    std::shared_ptr<StmtNode> parse_func_def(size_t& __idx, size_t __end_idx);
 
     // This function is for parsing return statements (Defined in parse_func_def).
-    void parse_return(size_t& __idx, size_t __end_idx, size_t __scope);
+    std::shared_ptr<StmtNode> parse_return(size_t& __idx, size_t __end_idx);
 
     // This function is for parsing if statements.
-    void parse_if(size_t& __idx, size_t __end_idx, size_t __scope);
+    std::shared_ptr<StmtNode> parse_if(size_t& __idx, size_t __end_idx);
 
     // This function is for parsing while loops.
-    void parse_while(size_t& __idx, size_t __end_idx, size_t __scope);
+    std::shared_ptr<StmtNode> parse_while(size_t& __idx, size_t __end_idx);
 
     // This function is for parsing for loops.
-    void parse_for(size_t& __idx, size_t __end_idx, size_t __scope);
+    std::shared_ptr<StmtNode> parse_for(size_t& __idx, size_t __end_idx);
 
     // These functions (also found in the parse_while.cpp file) are
     // loop controls.
-    void parse_continue(size_t& __idx, size_t __end_idx, size_t __scope);
-    void parse_break(size_t& __idx, size_t __end_idx, size_t __scope);
+    std::shared_ptr<StmtNode> parse_continue(size_t& __idx, size_t __end_idx);
+    std::shared_ptr<StmtNode> parse_break(size_t& __idx, size_t __end_idx);
 
-    // This function creates a group object.
-    std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-        parse_group(size_t& __idx, size_t __end_idx, size_t __scope);
+    // This function creates a group node.
+    node_idx parse_group(size_t& __idx, size_t __end_idx);
 
 private:
 
-    // This helper function determines if a string is reserved.
-    inline bool is_reserved(const std::string& n) const noexcept {
-        return _func_table->is_function(n) || _func_table->is_member_function(n) ||
-               _func_table->is_user_function(n) || is_keyword(n);
-    }
+    // This helper function parses an expression statement ending in a ';'.
+    std::shared_ptr<StmtNode> parse_expr_stmt(size_t& __idx, size_t __end_idx);
+
+    // This helper function parses the body between a pair of matching
+    // curly braces into a block statement.
+    std::shared_ptr<StmtNode> parse_body(size_t __open_idx, size_t __close_idx);
+
+    // This helper function moves the argument roots collected since
+    // __mark into the arena as the arguments of a node.
+    void store_args(node_idx __node, size_t __mark);
+
+    // This function folds the constant operators of a parsed expression
+    // tree into constants, and drops the identities that are type-safe.
+    // Returns if the node is constant.
+    bool fold_expr(node_idx __node);
+
+    // These helper functions (also found in fold_expr.cpp) return the
+    // object of a constant node, and the type a node is known to have
+    // before it runs.
+    RoskyValue get_const(node_idx __node) const;
+    OBJ_TYPES get_static_type(node_idx __node) const;
+
+    // These helper functions replace a node with a constant, or with one
+    // of its operands.
+    void set_const(node_idx __node, const RoskyValue& __obj);
+    void replace_node(node_idx __node, node_idx __operand);
 
 };
 
 /******************************************************************************/
 
 #endif // TOKEN_PARSER
+
+/******************************************************************************/
@@ -0,0 +1,66 @@
+/******************************************************************************/
+//
+//  Source Name:                pool_handler.hpp
+//
+//  Description:                This file is responsible for allocating
+//                              the boxed runtime objects (strings, groups,
+//                              ranges and pointers) from slab pools rather
+//                              than the general heap. Boxes allocate and
+//                              free themselves here by size.
+//
+//                              Each pool serves one size class. A pool
+//                              carves blocks from large slabs, and freed
+//                              blocks are kept on the pool's free list to
+//                              be reused by the next allocation of the
+//                              class. Sizes above the largest class go to
+//                              the general heap.
+//
+//                              Every pool counts its allocations, and how
+//                              many of them reused a freed block, so that
+//                              the hit rates can be reported at exit.
+//
+//  Dependencies:               None
+//
+//  Classes:                    None
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       pool_alloc
+//                              pool_free
+//                              enable_pool_stats
+//
+/******************************************************************************/
+
+#ifndef POOL_HANDLER
+#define POOL_HANDLER
+
+/******************************************************************************/
+
+#include <cstddef>                      // size_t
+
+/******************************************************************************/
+
+// The size classes are multiples of the granularity, up to the largest
+// class. Blocks are aligned to the granularity.
+#define POOL_GRANULARITY 16
+#define POOL_CLASS_COUNT 16
+
+// The size of each slab the blocks are carved from, in bytes.
+#define POOL_SLAB_SIZE 65536
+
+/******************************************************************************/
+
+// This function allocates a block of at least __size bytes.
+void* pool_alloc(size_t __size);
+
+// This function frees a block allocated with the same __size.
+void pool_free(void* __ptr, size_t __size) noexcept;
+
+// This function reports the hit rate of every pool to stderr at exit.
+void enable_pool_stats();
+
+/******************************************************************************/
+
+#endif // POOL_HANDLER
+
+/******************************************************************************/
@@ -8,6 +8,11 @@
 //                              command and formatting it into a usable
 //                              source object.
 //
+//                              The file is mapped into memory rather
+//                              than read, so the lexer scans the file's
+//                              bytes without copying them. Line endings
+//                              are left as they are in the file.
+//
 //  Dependencies:               None
 //
 //  Classes:                    Src_T
@@ -25,55 +30,105 @@
 /******************************************************************************/
 
 #include <string>                   // std::string
+#include <cstddef>                  // size_t
+
+#if defined(_WIN32)
 #include <fstream>                  // std::ifstream
+#include <sstream>                  // std::stringstream
+#else
+#include <fcntl.h>                  // open
+#include <sys/mman.h>               // mmap, munmap, madvise
+#include <sys/stat.h>               // fstat
+#include <unistd.h>                 // close
+#endif
 
 /******************************************************************************/
 
 // This struct is considered formatted source. It accepts
-// a filepath from stdin and creates a formatted source
-// within the constructor.
+// a filepath from stdin and maps the file in the constructor.
 struct Src_T {
 
     // This holds the source file name.
     std::string _filename;
 
-    // This holds the source file contents.
-    std::string _data;
+    // This holds the source file contents, which are not null
+    // terminated.
+    const char* _data;
+    size_t _size;
+
+#if defined(_WIN32)
+    // Without mmap the contents are read into a buffer.
+    std::string _buffer;
+#endif
 
     // Ctor.
     Src_T(const std::string& __filename)
-        : _filename(__filename) {
+        : _filename(__filename), _data(""), _size(0) {
 
-        // Read in the file from stdin.
-        std::ifstream in_file(_filename);
+#if defined(_WIN32)
 
-        // Read in the contents of the file line by line.
-        for (std::string line; std::getline(in_file, line); ) {
+        // Read in the whole file at once.
+        std::ifstream in_file(_filename, std::ios::binary);
+        std::stringstream contents;
+        contents << in_file.rdbuf();
 
-            // Some text editors insert carriage returns '13' at the end
-            // of lines, while others don't. Filter out carriage returns
-            // so the line endings are standardized.
-            if (int(line[line.size() - 1]) == 13) {
-                line = line.substr(0, line.size()-1);
-            }
+        _buffer = contents.str();
+        _data = _buffer.data();
+        _size = _buffer.size();
 
-            _data += line;
+#else
 
-            // Insert a new line character at the end of the line
-            _data += char(10);
+        // Open the file. A file that cannot be opened or is empty
+        // leaves the source empty.
+        int fd = open(_filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+
+            // Map the file read-only. It is scanned once from
+            // front to back.
+            void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+                madvise(map, info.st_size, MADV_SEQUENTIAL);
+                _data = static_cast<const char*>(map);
+                _size = info.st_size;
+            }
 
         }
 
-        // Close the file.
-        in_file.close();
+        // The mapping stays valid once the file is closed.
+        close(fd);
+
+#endif
 
     }
 
+    // The source owns its mapping, so it cannot be copied.
+    Src_T(const Src_T&) = delete;
+    Src_T& operator=(const Src_T&) = delete;
+
+    // Dtor.
+    ~Src_T() { clean(); }
+
     // This function allows us to unload the raw source data,
-    // saving heap memory.
+    // saving memory.
     inline void clean() noexcept {
-        _data.clear();
-        _data.shrink_to_fit();
+
+#if defined(_WIN32)
+        _buffer.clear();
+        _buffer.shrink_to_fit();
+#else
+        if (_size != 0) {
+            munmap(const_cast<char*>(_data), _size);
+        }
+#endif
+
+        _data = "";
+        _size = 0;
+
     }
 
 };
@@ -0,0 +1,218 @@
+/******************************************************************************/
+//
+//  Source Name:                compiler_utils.hpp
+//
+//  Description:                This file contains the type definitions
+//                              shared by the compiler and the virtual
+//                              machine, which are the instruction set
+//                              and the compiled chunk of bytecode.
+//
+//  Dependencies:               lexer_utils.hpp
+//                              parser_utils.hpp
+//
+//  Classes:                    Instr_T
+//                              Chunk_T
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       get_opcode
+//                              get_op_string
+//
+/******************************************************************************/
+
+#ifndef COMPILER_UTILS
+#define COMPILER_UTILS
+
+/******************************************************************************/
+
+#include <string>                       // std::string
+#include <vector>                       // std::vector
+#include <unordered_map>                // std::unordered_map
+#include <memory>                       // std::shared_ptr
+#include <utility>                      // std::pair
+
+#include "lexer_utils.hpp"
+#include "parser_utils.hpp"
+
+/******************************************************************************/
+
+// This enum defines the instruction set of the virtual machine. Each
+// instruction carries up to two integer operands (_a and _b).
+enum OPCODE_TYPE {
+
+    // Loads and stores.
+    OP_LOAD_CONST,      // push constant _a
+    OP_LOAD_LOCAL,      // push slot _a, or look up name _b if it is unbound
+    OP_LOAD_NAME,       // push variable named _a from the calling frames
+    OP_STORE_LOCAL,     // assign top to slot _a, bound at depth _b (top stays)
+    OP_STORE_REF,       // pop l-value, assign the new top to it
+    OP_POP,             // discard top
+
+    // Binary operators (pop right, pop left, push result).
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_IDIV,
+    OP_MOD,
+    OP_CONCAT,
+    OP_EQ,
+    OP_NEQ,
+    OP_GT,
+    OP_LT,
+    OP_GEQ,
+    OP_LEQ,
+    OP_AND,
+    OP_OR,
+    OP_XOR,
+    OP_SWAP,
+    OP_INDEX,
+
+    // Unary operators (pop operand, push result).
+    OP_NOT,
+    OP_DEREF,
+    OP_ADDR,
+
+    // Objects and calls.
+    OP_MAKE_GROUP,      // pop _a elements, push a group
+    OP_CALL,            // call function named _a with _b args
+    OP_CALL_MEMBER,     // call member function named _a with _b args
+    OP_RETURN,          // return top if _a, otherwise null
+    OP_DEF_FUNC,        // define nested function _a
+
+    // Control flow.
+    OP_JUMP,            // jump to _a
+    OP_JUMP_IF_FALSE,   // pop boolean condition, jump to _a if false
+    OP_JUMP_AND,        // jump to _a if top is false, keeping it as the result
+    OP_JUMP_OR,         // jump to _a if top is true, keeping it as the result
+    OP_RELEASE,         // unbind release list _b slots bound at depth >= _a
+    OP_ITER_INIT,       // pop iterable onto the iterator stack, bind slot _a at depth _b
+    OP_ITER_NEXT,       // assign next element to slot _a, or jump to _b if done
+    OP_ITER_END,        // pop the iterator stack
+
+};
+
+/******************************************************************************/
+
+// This struct defines a single instruction.
+struct Instr_T {
+
+    OPCODE_TYPE _op;
+    size_t _a;
+    size_t _b;
+
+    // Ctor.
+    Instr_T(OPCODE_TYPE __op, size_t __a, size_t __b)
+        : _op(__op), _a(__a), _b(__b) {}
+
+};
+
+/******************************************************************************/
+
+// This struct defines a compiled chunk of bytecode. The main program
+// and every user function compile into their own chunk.
+struct Chunk_T {
+
+    // The instruction stream, and the source position (colnum, linenum)
+    // of every instruction for error reporting.
+    std::vector<Instr_T> _code;
+    std::vector<std::pair<size_t, size_t>> _pos;
+
+    // The constant pool: the objects of the literal tokens referenced by
+    // OP_LOAD_CONST, formed once at compile time. Constants are never
+    // modified, so every load shares the same object.
+    std::vector<RoskyValue> _consts;
+
+    // The symbol and function names referenced by instructions, and the
+    // program-wide symbol id of each name.
+    std::vector<std::string> _names;
+    std::vector<size_t> _name_ids;
+
+    // The number of variable slots in the chunk's frame, and the slots
+    // each symbol id is bound to, in the order they were allocated.
+    // Slots are searched in reverse when the variable is looked up by
+    // name from a called function.
+    size_t _num_slots;
+    std::unordered_map<size_t, std::vector<size_t>> _slot_map;
+
+    // The slots each OP_RELEASE may have to unbind.
+    std::vector<std::vector<size_t>> _releases;
+
+    // The functions defined within this chunk, referenced by OP_DEF_FUNC.
+    std::vector<std::shared_ptr<Chunk_T>> _funcs;
+
+    // Function chunks only: the function name, and the parameter names
+    // along with their source positions.
+    std::string _func_name;
+    std::vector<std::string> _params;
+    std::vector<std::pair<size_t, size_t>> _param_pos;
+
+    // Ctor.
+    Chunk_T() : _num_slots(0) {}
+
+};
+
+/******************************************************************************/
+
+// This function maps a resolved operator to its opcode. Assignment is
+// handled by the compiler itself.
+inline OPCODE_TYPE get_opcode(OPERATOR_TYPE op) noexcept {
+    switch (op) {
+        case OPER_ADD:      return OP_ADD;
+        case OPER_SUB:      return OP_SUB;
+        case OPER_MUL:      return OP_MUL;
+        case OPER_DIV:      return OP_DIV;
+        case OPER_IDIV:     return OP_IDIV;
+        case OPER_MOD:      return OP_MOD;
+        case OPER_CONCAT:   return OP_CONCAT;
+        case OPER_EQ:       return OP_EQ;
+        case OPER_NEQ:      return OP_NEQ;
+        case OPER_GT:       return OP_GT;
+        case OPER_LT:       return OP_LT;
+        case OPER_GEQ:      return OP_GEQ;
+        case OPER_LEQ:      return OP_LEQ;
+        case OPER_AND:      return OP_AND;
+        case OPER_OR:       return OP_OR;
+        case OPER_XOR:      return OP_XOR;
+        case OPER_SWAP:     return OP_SWAP;
+        case OPER_NOT:      return OP_NOT;
+        case OPER_DEREF:    return OP_DEREF;
+        case OPER_ADDR:     return OP_ADDR;
+        default:            return OP_INDEX;
+    }
+}
+
+// This function returns the operator string of an operator opcode
+// for error reporting.
+inline std::string get_op_string(OPCODE_TYPE op) noexcept {
+    switch (op) {
+        case OP_ADD:    return "+";
+        case OP_SUB:    return "-";
+        case OP_MUL:    return "*";
+        case OP_DIV:    return "/";
+        case OP_IDIV:   return "//";
+        case OP_MOD:    return "%";
+        case OP_CONCAT: return "&";
+        case OP_EQ:     return "==";
+        case OP_NEQ:    return "!=";
+        case OP_GT:     return ">";
+        case OP_LT:     return "<";
+        case OP_GEQ:    return ">=";
+        case OP_LEQ:    return "<=";
+        case OP_AND:    return "and";
+        case OP_OR:     return "or";
+        case OP_XOR:    return "xor";
+        case OP_SWAP:   return "<->";
+        case OP_INDEX:  return "index";
+        case OP_NOT:    return "!";
+        case OP_DEREF:  return "deref";
+        case OP_ADDR:   return "@";
+        default:        return "";
+    }
+}
+
+/******************************************************************************/
+
+#endif // COMPILER_UTILS
+
+/******************************************************************************/
@@ -10,16 +10,25 @@
 //  Dependencies:               None
 //
 //  Classes:                    Token_T
+//                              TokenTable_T
+//                              FixedToken_T
+//                              CharTable_T
+//                              KeywordTable_T
+//                              SymbolDfa_T
 //
 //  Inherited Subprograms:      None
 //
-//  Exported Subprograms:       is_alpha
+//  Exported Subprograms:       is_char_class
+//                              is_alpha
 //                              is_num
 //                              is_alphanum
 //                              is_whitespace
 //                              is_op
 //                              is_delimiter
 //                              is_ctrl_struct
+//                              is_keyword
+//                              get_keyword
+//                              match_symbol
 //                              
 /******************************************************************************/
 
@@ -30,12 +39,15 @@
 
 #include <string>                       // std::string
 #include <vector>                       // std::vector
+#include <unordered_map>                // std::unordered_map
+#include <utility>                      // std::pair
+#include <cstdint>                      // uint8_t, uint32_t
 
 /******************************************************************************/
 
 // This enum defines the types of different tokens the
 // lexer can form.
-enum TOKEN_TYPE {
+enum TOKEN_TYPE : uint8_t {
 
     // Generic
     TOKEN_SYMBOL,
@@ -80,46 +92,213 @@ static std::vector<std::string> TOKEN_STRINGS = {
 
 /******************************************************************************/
 
-// This defines the keywords that are recognized by the lexer.
-static std::vector<std::string> keywords = {
-    "false",
-    "true",
-    "null",
-    "nullptr",
-    "if",
-    "elsif",
-    "else",
-    "while",
-    "continue",
-    "break",
-    "and",
-    "or",
-    "xor",
-    "for",
-    "in",
-    "return",
-    "func"
+// This enum defines the kind of each token. Every keyword, operator,
+// delimiter and control structure is a kind of its own, so the parser
+// never has to compare token strings.
+enum TOKEN_KIND : uint8_t {
+
+    // Symbols and literals.
+    KIND_SYMBOL,
+    KIND_INT,
+    KIND_FLOAT,
+    KIND_STRING,
+
+    // Keywords.
+    KIND_FALSE,
+    KIND_TRUE,
+    KIND_NULL,
+    KIND_NULLPTR,
+    KIND_IF,
+    KIND_ELSIF,
+    KIND_ELSE,
+    KIND_WHILE,
+    KIND_CONTINUE,
+    KIND_BREAK,
+    KIND_AND,
+    KIND_OR,
+    KIND_XOR,
+    KIND_FOR,
+    KIND_IN,
+    KIND_RETURN,
+    KIND_FUNC,
+
+    // Operators.
+    KIND_ADD,           // +
+    KIND_STAR,          // *
+    KIND_ASSIGN,        // =
+    KIND_AT,            // @
+    KIND_AMP,           // &
+    KIND_LBRACKET,      // [
+    KIND_RBRACKET,      // ]
+    KIND_SUB,           // -
+    KIND_DIV,           // /
+    KIND_IDIV,          // //
+    KIND_MOD,           // %
+    KIND_NOT,           // !
+    KIND_LT,            // <
+    KIND_GT,            // >
+    KIND_EQ,            // ==
+    KIND_NEQ,           // !=
+    KIND_LEQ,           // <=
+    KIND_GEQ,           // >=
+    KIND_SWAP,          // <->
+
+    // Delimiters.
+    KIND_SEMI,          // ;
+    KIND_COMMA,         // ,
+    KIND_DOT,           // .
+
+    // Control structures.
+    KIND_LPAREN,        // (
+    KIND_RPAREN,        // )
+    KIND_LBRACE,        // {
+    KIND_RBRACE,        // }
+
 };
 
 /******************************************************************************/
 
-// This struct defines the token class. It contains the
-// raw token itself, along with metadata.
+// This struct defines a token with fixed text: a keyword, operator,
+// delimiter or control structure.
+struct FixedToken_T {
+    const char* _text;
+    TOKEN_KIND _kind;
+    TOKEN_TYPE _type;
+};
+
+// This defines every token with fixed text. The keyword hash, the symbol
+// recognizer and the character classes are all generated from it at
+// compile time, so a new keyword or operator only needs an entry here
+// (and its kind).
+constexpr FixedToken_T fixed_tokens[] = {
+
+    // Keywords.
+    {"false", KIND_FALSE, TOKEN_KW},
+    {"true", KIND_TRUE, TOKEN_KW},
+    {"null", KIND_NULL, TOKEN_KW},
+    {"nullptr", KIND_NULLPTR, TOKEN_KW},
+    {"if", KIND_IF, TOKEN_KW},
+    {"elsif", KIND_ELSIF, TOKEN_KW},
+    {"else", KIND_ELSE, TOKEN_KW},
+    {"while", KIND_WHILE, TOKEN_KW},
+    {"continue", KIND_CONTINUE, TOKEN_KW},
+    {"break", KIND_BREAK, TOKEN_KW},
+    {"and", KIND_AND, TOKEN_KW},
+    {"or", KIND_OR, TOKEN_KW},
+    {"xor", KIND_XOR, TOKEN_KW},
+    {"for", KIND_FOR, TOKEN_KW},
+    {"in", KIND_IN, TOKEN_KW},
+    {"return", KIND_RETURN, TOKEN_KW},
+    {"func", KIND_FUNC, TOKEN_KW},
+
+    // Operators.
+    {"+", KIND_ADD, TOKEN_OP},
+    {"*", KIND_STAR, TOKEN_OP},
+    {"=", KIND_ASSIGN, TOKEN_OP},
+    {"@", KIND_AT, TOKEN_OP},
+    {"&", KIND_AMP, TOKEN_OP},
+    {"[", KIND_LBRACKET, TOKEN_OP},
+    {"]", KIND_RBRACKET, TOKEN_OP},
+    {"-", KIND_SUB, TOKEN_OP},
+    {"/", KIND_DIV, TOKEN_OP},
+    {"//", KIND_IDIV, TOKEN_OP},
+    {"%", KIND_MOD, TOKEN_OP},
+    {"!", KIND_NOT, TOKEN_OP},
+    {"<", KIND_LT, TOKEN_OP},
+    {">", KIND_GT, TOKEN_OP},
+    {"==", KIND_EQ, TOKEN_OP},
+    {"!=", KIND_NEQ, TOKEN_OP},
+    {"<=", KIND_LEQ, TOKEN_OP},
+    {">=", KIND_GEQ, TOKEN_OP},
+    {"<->", KIND_SWAP, TOKEN_OP},
+
+    // Delimiters.
+    {";", KIND_SEMI, TOKEN_DELIM},
+    {",", KIND_COMMA, TOKEN_DELIM},
+    {".", KIND_DOT, TOKEN_DELIM},
+
+    // Control structures.
+    {"(", KIND_LPAREN, TOKEN_CTRL},
+    {")", KIND_RPAREN, TOKEN_CTRL},
+    {"{", KIND_LBRACE, TOKEN_CTRL},
+    {"}", KIND_RBRACE, TOKEN_CTRL},
+
+};
+
+constexpr size_t FIXED_TOKEN_COUNT = sizeof(fixed_tokens) / sizeof(fixed_tokens[0]);
+
+/******************************************************************************/
+
+// This struct defines the token class. Tokens are stored by value in
+// the token table, and their text is interned in it.
 struct Token_T {
 
-    std::string _token;
+    TOKEN_KIND _kind;
     TOKEN_TYPE _type;
 
+    // The id of the token's text in the token table. Equal symbols
+    // share an id.
+    uint32_t _id;
+
     // The position within the source file this token occurs in.
-    size_t _colnum;
-    size_t _linenum;
+    uint32_t _colnum;
+    uint32_t _linenum;
 
     // Ctor.
-    Token_T(const std::string& __token,
-            TOKEN_TYPE __type,
+    Token_T(TOKEN_KIND __kind, TOKEN_TYPE __type, uint32_t __id,
             size_t __colnum, size_t __linenum)
-        : _token(__token), _type(__type),
-        _colnum(__colnum), _linenum(__linenum) {}
+        : _kind(__kind), _type(__type), _id(__id),
+        _colnum((uint32_t)__colnum), _linenum((uint32_t)__linenum) {}
+
+};
+
+/******************************************************************************/
+
+// This class defines the token table. It holds the tokens contiguously,
+// along with the text of each distinct token.
+class TokenTable_T {
+
+private:
+
+    std::vector<Token_T> _tokens;
+
+    // The text of each id, and the id of each text.
+    std::vector<std::string> _text;
+    std::unordered_map<std::string, uint32_t> _ids;
+
+public:
+
+    // This function appends a token, interning its text.
+    void push(const char* __text, size_t __len, TOKEN_KIND __kind, TOKEN_TYPE __type,
+              size_t __colnum, size_t __linenum) {
+
+        std::string text(__text, __len);
+
+        uint32_t id;
+        auto entry = _ids.find(text);
+        if (entry == _ids.end()) {
+            id = (uint32_t)_text.size();
+            _ids.emplace(text, id);
+            _text.push_back(std::move(text));
+        } else {
+            id = entry->second;
+        }
+
+        _tokens.emplace_back(__kind, __type, id, __colnum, __linenum);
+
+    }
+
+    void push(const std::string& __text, TOKEN_KIND __kind, TOKEN_TYPE __type,
+              size_t __colnum, size_t __linenum) {
+        push(__text.data(), __text.size(), __kind, __type, __colnum, __linenum);
+    }
+
+    size_t size() const noexcept { return _tokens.size(); }
+
+    const Token_T& operator[](size_t __idx) const noexcept { return _tokens[__idx]; }
+
+    // This function returns the text of the token at an index.
+    const std::string& text(size_t __idx) const noexcept { return _text[_tokens[__idx]._id]; }
 
 };
 
@@ -135,52 +314,268 @@ struct Token_T {
 
 /******************************************************************************/
 
+// This enum defines the classes of characters the lexer dispatches on.
+// A character can belong to more than one class.
+enum CHAR_CLASS : uint8_t {
+    CHAR_ALPHA = 1,             // A-Z a-z _
+    CHAR_NUM = 2,               // 0-9
+    CHAR_SPACE = 4,             // space, tabs and newline
+    CHAR_OP = 8,                // + * = @ & [ ] - / % ! < >
+    CHAR_DELIM = 16,            // ; , .
+    CHAR_CTRL = 32,             // ( ) { }
+};
+
+// This struct holds the class of every character.
+struct CharTable_T {
+    uint8_t _class[256];
+};
+
+// This function builds the character class table at compile time.
+constexpr CharTable_T make_char_table() {
+
+    CharTable_T table{};
+
+    for (int c = 'A'; c <= 'Z'; c++) { table._class[c] |= CHAR_ALPHA; }
+    for (int c = 'a'; c <= 'z'; c++) { table._class[c] |= CHAR_ALPHA; }
+    table._class[(int)'_'] |= CHAR_ALPHA;
+
+    for (int c = '0'; c <= '9'; c++) { table._class[c] |= CHAR_NUM; }
+
+    table._class[SPACE] |= CHAR_SPACE;
+    table._class[HORIZTAB] |= CHAR_SPACE;
+    table._class[VERTTAB] |= CHAR_SPACE;
+    table._class[NEWLINE] |= CHAR_SPACE;
+
+    // The characters of the fixed symbols take their token's class.
+    for (size_t tok = 0; tok < FIXED_TOKEN_COUNT; tok++) {
+
+        uint8_t char_class = fixed_tokens[tok]._type == TOKEN_OP ? CHAR_OP :
+                             fixed_tokens[tok]._type == TOKEN_DELIM ? CHAR_DELIM :
+                             fixed_tokens[tok]._type == TOKEN_CTRL ? CHAR_CTRL : 0;
+
+        for (size_t i = 0; char_class != 0 && fixed_tokens[tok]._text[i] != 0; i++) {
+            table._class[(unsigned char)fixed_tokens[tok]._text[i]] |= char_class;
+        }
+
+    }
+
+    return table;
+
+}
+
+constexpr CharTable_T char_table = make_char_table();
+
+/******************************************************************************/
+
 // This section contains various utility functions for the lexer.
 // All utility functions must be non-throwing.
 
+inline bool is_char_class(char c, uint8_t __class) noexcept {
+    return (char_table._class[(unsigned char)c] & __class) != 0;
+}
+
 inline bool is_alpha(char c) noexcept {
-    return (c >= 'A' && c <= 'Z') ||
-           (c >= 'a' && c <= 'z') ||
-           (c == '_');
+    return is_char_class(c, CHAR_ALPHA);
 }
 
 inline bool is_num(char c) noexcept {
-    return (c >= '0' && c <= '9');
+    return is_char_class(c, CHAR_NUM);
 }
 
 inline bool is_alphanum(char c) noexcept {
-    return is_alpha(c) || is_num(c);
+    return is_char_class(c, CHAR_ALPHA | CHAR_NUM);
 }
 
 inline bool is_whitespace(char c) noexcept {
-    return (int(c) == SPACE) || 
-           (int(c) == HORIZTAB) ||
-           (int(c) == VERTTAB) ||
-           (int(c) == NEWLINE);
+    return is_char_class(c, CHAR_SPACE);
 }
 
 inline bool is_op(char c) noexcept {
-    std::string op_string = "+*=@&[]-/%!<>";
-    for (auto& op : op_string) {
-        if (c == op) { return true; }
-    }
-    return false;
+    return is_char_class(c, CHAR_OP);
 }
 
 inline bool is_delimiter(char c) noexcept {
-    return (c == ';') || (c == ',') || (c == '.');
+    return is_char_class(c, CHAR_DELIM);
 }
 
 inline bool is_ctrl_struct(char c) noexcept {
-    return (c == '(') || (c == ')') ||
-           (c == '{') || (c == '}');
+    return is_char_class(c, CHAR_CTRL);
+}
+
+// This section contains the keyword hash. Keywords are hashed with a
+// seeded FNV-1a into a table with one keyword per slot. The seed is
+// searched for at compile time.
+
+#define KEYWORD_SLOTS 64
+
+// This function hashes a string to a keyword slot.
+constexpr uint32_t keyword_hash(const char* s, size_t len, uint32_t seed) noexcept {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)s[i]) * 16777619u;
+    }
+    return h >> 26;             // The top 6 bits, for 64 slots.
+}
+
+// This function returns the length of a null terminated string.
+constexpr size_t fixed_length(const char* s) noexcept {
+    size_t len = 0;
+    while (s[len] != 0) { len++; }
+    return len;
+}
+
+// This struct holds the keyword hash table. Each slot holds the index
+// of its keyword in fixed_tokens, or -1.
+struct KeywordTable_T {
+    uint32_t _seed;
+    int8_t _slot[KEYWORD_SLOTS];
+};
+
+// This function builds the keyword table, trying seeds until no two
+// keywords share a slot.
+constexpr KeywordTable_T make_keyword_table() {
+
+    KeywordTable_T table{};
+
+    for (uint32_t seed = 0; ; seed++) {
+
+        for (size_t slot = 0; slot < KEYWORD_SLOTS; slot++) {
+            table._slot[slot] = -1;
+        }
+        table._seed = seed;
+
+        bool collision = false;
+        for (size_t tok = 0; tok < FIXED_TOKEN_COUNT && !collision; tok++) {
+
+            if (fixed_tokens[tok]._type != TOKEN_KW) {
+                continue;
+            }
+
+            const char* text = fixed_tokens[tok]._text;
+            uint32_t slot = keyword_hash(text, fixed_length(text), seed);
+            if (table._slot[slot] != -1) {
+                collision = true;
+            }
+            table._slot[slot] = (int8_t)tok;
+
+        }
+
+        if (!collision) {
+            return table;
+        }
+
+    }
+
+}
+
+constexpr KeywordTable_T keyword_table = make_keyword_table();
+
+// This function returns the kind of a keyword, or KIND_SYMBOL if the
+// string is not a keyword.
+inline TOKEN_KIND get_keyword(const char* s, size_t len) noexcept {
+
+    int8_t tok = keyword_table._slot[keyword_hash(s, len, keyword_table._seed)];
+    if (tok == -1) {
+        return KIND_SYMBOL;
+    }
+
+    // The slot's keyword must match exactly, terminator included.
+    const char* text = fixed_tokens[tok]._text;
+    for (size_t i = 0; i < len; i++) {
+        if (text[i] != s[i]) { return KIND_SYMBOL; }
+    }
+    return text[len] == 0 ? fixed_tokens[tok]._kind : KIND_SYMBOL;
+
 }
 
 inline bool is_keyword(const std::string& s) noexcept {
-    for (auto& kw : keywords) {
-        if (kw == s) { return true; }
+    return get_keyword(s.data(), s.size()) != KIND_SYMBOL;
+}
+
+/******************************************************************************/
+
+// This section contains the symbol recognizer for operators, delimiters
+// and control structures. It is a DFA (the trie of the fixed symbols)
+// whose transitions are a table lookup per character. State 0 is dead
+// and state 1 is the start.
+
+// This function returns the number of DFA states the fixed symbols need.
+constexpr size_t count_symbol_states() noexcept {
+    size_t states = 2;
+    for (size_t tok = 0; tok < FIXED_TOKEN_COUNT; tok++) {
+        if (fixed_tokens[tok]._type != TOKEN_KW) {
+            states += fixed_length(fixed_tokens[tok]._text);
+        }
+    }
+    return states;
+}
+
+constexpr size_t SYMBOL_STATES = count_symbol_states();
+
+// This struct holds the DFA. A state accepts if its token index is
+// not -1.
+struct SymbolDfa_T {
+    uint8_t _next[SYMBOL_STATES][256];
+    int8_t _token[SYMBOL_STATES];
+};
+
+// This function builds the DFA from the fixed symbols.
+constexpr SymbolDfa_T make_symbol_dfa() {
+
+    SymbolDfa_T dfa{};
+    for (size_t state = 0; state < SYMBOL_STATES; state++) {
+        dfa._token[state] = -1;
+    }
+
+    uint8_t states = 2;
+    for (size_t tok = 0; tok < FIXED_TOKEN_COUNT; tok++) {
+
+        if (fixed_tokens[tok]._type == TOKEN_KW) {
+            continue;
+        }
+
+        uint8_t state = 1;
+        for (size_t i = 0; fixed_tokens[tok]._text[i] != 0; i++) {
+            unsigned char c = fixed_tokens[tok]._text[i];
+            if (dfa._next[state][c] == 0) {
+                dfa._next[state][c] = states++;
+            }
+            state = dfa._next[state][c];
+        }
+        dfa._token[state] = (int8_t)tok;
+
+    }
+
+    return dfa;
+
+}
+
+constexpr SymbolDfa_T symbol_dfa = make_symbol_dfa();
+
+// This function matches the longest fixed symbol at the start of s.
+// Returns its length and sets its index in fixed_tokens, or returns 0
+// if no symbol starts there.
+inline size_t match_symbol(const char* s, size_t len, size_t& __token) noexcept {
+
+    size_t match = 0;
+    uint8_t state = 1;
+
+    for (size_t i = 0; i < len; i++) {
+
+        state = symbol_dfa._next[state][(unsigned char)s[i]];
+        if (state == 0) {
+            break;
+        }
+
+        if (symbol_dfa._token[state] != -1) {
+            match = i + 1;
+            __token = symbol_dfa._token[state];
+        }
+
     }
-    return false;
+
+    return match;
+
 }
 
 /******************************************************************************/
@@ -8,23 +8,28 @@
 //                              the parser to leverage.
 //
 //  Dependencies:               lexer_utils.hpp
-//                              variable_handler.hpp
 //                              
 //                              all object definition files
 //
 //  Classes:                    ParseNode
+//                              ExprArena_T
+//                              StmtNode
+//                              TokenIndex_T
 //
 //  Inherited Subprograms:      None
 //
 //  Exported Subprograms:       get_precedence
+//                              get_operator
 //                              insert_right
 //                              insert_op
+//                              replace_right
+//                              make_subexpr
 //                              is_expr_op
 //                              is_literal
-//                              is_assignment_op
 //                              is_right_assoc
-//                              is_left_assoc
 //                              is_unary_op
+//                              is_unary_oper
+//                              index_tokens
 //                              find_nextof
 //                              find_matching_ctrl
 //                              form_object
@@ -37,13 +42,14 @@
 /******************************************************************************/
 
 #include <string>                       // std::string
-#include <memory>                       // std::shared_ptr, std::weak_ptr
+#include <memory>                       // std::shared_ptr
+#include <cstdint>                      // uint8_t, uint32_t
 #include <iostream>                     // std::cout, std::endl;
 #include <deque>                        // std::deque
 #include <utility>                      // std::pair
+#include <vector>                       // std::vector
 
 #include "lexer_utils.hpp"
-#include "../variable_handler.hpp"
 
 #include "../objects/rosky_interface.hpp"
 #include "../objects/rosky_int.hpp"
@@ -55,104 +61,274 @@
 
 /******************************************************************************/
 
+// This defines the operators an operator node can hold. Operators are
+// resolved once from their token when the tree is built, so nothing
+// downstream of the parser compares operator strings.
+enum OPERATOR_TYPE : uint8_t {
+    OPER_NONE,              // Operand nodes.
+    OPER_ASSIGN,
+    OPER_SWAP,
+    OPER_OR,
+    OPER_XOR,
+    OPER_AND,
+    OPER_EQ,
+    OPER_NEQ,
+    OPER_GT,
+    OPER_LT,
+    OPER_GEQ,
+    OPER_LEQ,
+    OPER_CONCAT,
+    OPER_ADD,
+    OPER_SUB,
+    OPER_MUL,
+    OPER_DIV,
+    OPER_IDIV,
+    OPER_MOD,
+    OPER_DEREF,
+    OPER_ADDR,
+    OPER_NOT,
+    OPER_INDEX,
+    OPER_COUNT,
+};
+
+// The precedence of each operator, indexed by OPERATOR_TYPE.
+constexpr size_t op_precedence[OPER_COUNT] = {
+    0,                      // none
+    1,                      // =
+    2,                      // <->
+    3,                      // or
+    4,                      // xor
+    5,                      // and
+    6, 6, 6, 6, 6, 6,       // == != > < >= <=
+    7,                      // &
+    8, 8,                   // + -
+    9, 9, 9, 9,             // * / // %
+    10, 10, 10,             // deref @ !
+    11,                     // [
+};
+
 // This function allows us to get operator precedence.
-inline size_t get_precedence(const std::string& op) {
-    if (op == "=") { return 1; }
-    if (op == "<->") { return 2; }
-    if (op == "or") { return 3; }
-    if (op == "xor") { return 4; }
-    if (op == "and") { return 5; }
-    if (op == "==" || op == "!=" || op == ">" || op == "<" ||
-        op == ">=" || op == "<=") { return 6; }
-    if (op == "&") { return 7; }
-    if (op == "+" || op == "-") { return 8; }
-    if (op == "*" || op == "/" || op == "//" || op == "%") { return 9; }
-    if (op == "de" || op == "@") { return 10; }
-    if (op == "!") { return 10; }
-    if (op == "[") { return 11; }
-    return 0;
+inline size_t get_precedence(OPERATOR_TYPE op) noexcept {
+    return op_precedence[op];
+}
+
+// This function resolves an operator token to its operator type.
+// The unary flag selects deref over multiply for '*'. Returns
+// OPER_NONE if the token is not an operator.
+inline OPERATOR_TYPE get_operator(TOKEN_KIND __kind, bool __unary) noexcept {
+
+    switch (__kind) {
+        case KIND_ASSIGN:   return OPER_ASSIGN;
+        case KIND_EQ:       return OPER_EQ;
+        case KIND_NOT:      return OPER_NOT;
+        case KIND_NEQ:      return OPER_NEQ;
+        case KIND_GT:       return OPER_GT;
+        case KIND_GEQ:      return OPER_GEQ;
+        case KIND_LT:       return OPER_LT;
+        case KIND_LEQ:      return OPER_LEQ;
+        case KIND_SWAP:     return OPER_SWAP;
+        case KIND_DIV:      return OPER_DIV;
+        case KIND_IDIV:     return OPER_IDIV;
+        case KIND_STAR:     return __unary ? OPER_DEREF : OPER_MUL;
+        case KIND_ADD:      return OPER_ADD;
+        case KIND_SUB:      return OPER_SUB;
+        case KIND_MOD:      return OPER_MOD;
+        case KIND_AMP:      return OPER_CONCAT;
+        case KIND_AT:       return OPER_ADDR;
+        case KIND_LBRACKET: return OPER_INDEX;
+        case KIND_AND:      return OPER_AND;
+        case KIND_OR:       return OPER_OR;
+        case KIND_XOR:      return OPER_XOR;
+        default:            return OPER_NONE;
+    }
+
 }
 
 /******************************************************************************/
 
 // This defines the type of node the parse node is.
-enum PARSE_NODE_TYPE {
+enum PARSE_NODE_TYPE : uint8_t {
     PARSE_OPERATOR,
     PARSE_OPERAND,
 };
 
 /******************************************************************************/
 
-// This struct defines the parse tree node structure. The pointer
-// to the parent node must be a weak_ptr to avoid cyclic referencing
-// which would not allow memory to be freed from the shared_ptr's
-// when the stack is unwound.
+// This defines the kind of operand an operand node holds. Operands
+// are resolved to objects by the executor each time the tree is
+// evaluated, except for the constants folded from operators, whose
+// objects the arena holds.
+enum OPERAND_TYPE : uint8_t {
+    OPERAND_NONE,           // Operator nodes.
+    OPERAND_LITERAL,        // Literal tokens and value keywords (true, null...).
+    OPERAND_SYMBOL,         // Variable references.
+    OPERAND_CALL,           // Function calls, _args holds the arguments.
+    OPERAND_MEMBER_CALL,    // Member function calls on the _target operand.
+    OPERAND_GROUP,          // Group literals, _args holds the elements.
+    OPERAND_EXPR,           // Parenthesized or bracketed sub-expressions.
+    OPERAND_CONST,          // Folded constants, _args holds the constant.
+};
+
+/******************************************************************************/
+
+// This defines the index of a node in its expression arena.
+typedef uint32_t node_idx;
+
+// The index of an absent node.
+constexpr node_idx NO_NODE = UINT32_MAX;
+
+// This struct defines the parse tree node structure. Nodes live in an
+// expression arena and link to each other by index, so building and
+// freeing a tree does not allocate per node.
 struct ParseNode {
 
-    std::shared_ptr<RoskyInterface>* _obj_adr;  // For pointer referencing
-    std::shared_ptr<RoskyInterface> _obj;
-    std::string _op;
+    OPERATOR_TYPE _oper;
     PARSE_NODE_TYPE _type;
+    OPERAND_TYPE _operand;
+
+    // The index of the token the node is formed from, which holds the
+    // literal, symbol or function name and the node's source position.
+    uint32_t _token;
+
+    // The object of a member call, or the root of a sub-expression.
+    node_idx _target;
+
+    // The arguments of a call, or the elements of a group, as a range
+    // of the arena's argument list. A folded constant holds the index
+    // of its object in the arena's constants instead.
+    uint32_t _args;
+    uint32_t _nargs;
+
+    node_idx _left;
+    node_idx _right;
+    node_idx _parent;
+
+    // Ctor.
+    ParseNode(PARSE_NODE_TYPE __type, OPERAND_TYPE __operand, uint32_t __token)
+        : _oper(OPER_NONE), _type(__type), _operand(__operand), _token(__token),
+          _target(NO_NODE), _args(0), _nargs(0),
+          _left(NO_NODE), _right(NO_NODE), _parent(NO_NODE) {}
+
+};
+
+/******************************************************************************/
+
+// This struct defines the arena the expression nodes of a function body
+// (or of the main program) are stored in.
+struct ExprArena_T {
+
+    // The nodes, in the order they were created.
+    std::vector<ParseNode> _nodes;
+
+    // The argument lists of every call and group node, back to back.
+    std::vector<node_idx> _args;
+
+    // The objects of the folded constant nodes.
+    std::vector<RoskyValue> _consts;
+
+    // This function adds a node to the arena and returns its index.
+    node_idx add(PARSE_NODE_TYPE __type, OPERAND_TYPE __operand, uint32_t __token) {
+        _nodes.emplace_back(__type, __operand, __token);
+        return (node_idx)(_nodes.size() - 1);
+    }
+
+    ParseNode& operator[](node_idx __idx) noexcept { return _nodes[__idx]; }
+    const ParseNode& operator[](node_idx __idx) const noexcept { return _nodes[__idx]; }
+
+    // This function returns the __n'th argument of a node.
+    node_idx arg(const ParseNode& __node, size_t __n) const noexcept {
+        return _args[__node._args + __n];
+    }
+
+};
+
+/******************************************************************************/
+
+// This defines the type of statement a statement node is.
+enum STMT_TYPE {
+    STMT_EXPR,
+    STMT_BLOCK,
+    STMT_IF,
+    STMT_WHILE,
+    STMT_FOR,
+    STMT_FUNC_DEF,
+    STMT_RETURN,
+    STMT_BREAK,
+    STMT_CONTINUE,
+};
+
+/******************************************************************************/
+
+// This struct defines a statement node. The parser builds a tree of
+// these once for the whole program, and the executor walks it.
+//
+// _exprs holds the expression of an expression or return statement,
+// the conditions of an if or while, or the iterable of a for loop,
+// as roots in the arena of the enclosing function.
+// _stmts holds the statements of a block, or the body blocks of
+// the compound statements (an extra trailing body on an if is the else).
+struct StmtNode {
+
+    STMT_TYPE _type;
     size_t _colnum;
     size_t _linenum;
-    size_t _recrusive_index;
 
-    std::shared_ptr<ParseNode> _left;
-    std::shared_ptr<ParseNode> _right;
-    std::weak_ptr<ParseNode> _parent;
+    std::vector<node_idx> _exprs;
+
+    // The source position to report when the matching expression
+    // does not yield a usable value (i.e. a non-boolean condition).
+    std::vector<std::pair<size_t, size_t>> _expr_pos;
+
+    std::vector<std::shared_ptr<StmtNode>> _stmts;
+
+    // The loop variable of a for, or the name of a function.
+    std::string _name;
+
+    // The parameter names of a function and their source positions.
+    std::vector<std::string> _params;
+    std::vector<std::pair<size_t, size_t>> _param_pos;
+
+    // The arena holding the expressions of a function's body.
+    std::shared_ptr<ExprArena_T> _arena;
 
     // Ctor.
-    ParseNode(std::shared_ptr<RoskyInterface>* __obj_adr,
-              const std::shared_ptr<RoskyInterface>& __obj,
-              const std::string __op, PARSE_NODE_TYPE __type,
-              size_t __col, size_t __lin, size_t __r_index)
-        : _obj_adr(__obj_adr), _obj(__obj), _op(__op),
-          _type(__type), _colnum(__col), _linenum(__lin),
-          _recrusive_index(__r_index) {}
-
-    // Compare to nullptr
-    inline bool is_nullptr() const noexcept {
-        return _obj_adr == nullptr && _obj == nullptr;
-    }
+    StmtNode(STMT_TYPE __type, size_t __col, size_t __lin)
+        : _type(__type), _colnum(__col), _linenum(__lin) {}
 
 };
 
 /******************************************************************************/
 
-// This function is a tree helper function that inserts a child node
+// This function is a tree helper function that inserts an operand node
 // as far right down the tree as possible.
-void insert_right(std::shared_ptr<ParseNode>& __root,
-                  std::shared_ptr<RoskyInterface>* __obj_adr,
-                  const std::shared_ptr<RoskyInterface>& __obj,
-                  const std::string& __sym_string,
-                  size_t __col, size_t __lin,
-                  size_t __r_index);
+void insert_right(ExprArena_T& __arena, node_idx& __root, node_idx __node);
 
 // This function is a tree helper function for inserting operators
 // into the tree.
-void insert_op(std::shared_ptr<ParseNode>& __root,
-               const std::string& __op,
-               size_t __col, size_t __lin);
+void insert_op(ExprArena_T& __arena, node_idx& __root,
+               OPERATOR_TYPE __oper, uint32_t __token);
+
+// This function replaces the right-most operand of the tree with
+// the given node.
+void replace_right(ExprArena_T& __arena, node_idx& __root, node_idx __node);
 
-// This function replaces the object contents of the right-most
-// object with given object contents.
-void replace_right(std::shared_ptr<ParseNode>& __root,
-                   std::shared_ptr<RoskyInterface>* __obj_adr,
-                   const std::shared_ptr<RoskyInterface>& __obj);
+// This function wraps the root of a sub-expression so the tree helpers
+// treat it as a single operand. Operand roots are returned as they are.
+node_idx make_subexpr(ExprArena_T& __arena, node_idx __sub_root, uint32_t __token);
 
 // This function returns the last object added to the tree, which
 // happens to be furthest right.
-std::shared_ptr<ParseNode> get_last_obj(const std::shared_ptr<ParseNode>& __root);
+node_idx get_last_obj(const ExprArena_T& __arena, node_idx __root);
 
 // This is a debug function for displaying the parse tree.
-void print_inorder(const std::shared_ptr<ParseNode>& __root);
+void print_inorder(const ExprArena_T& __arena, const TokenTable_T& __tokens, node_idx __root);
 
 /******************************************************************************/
 
 // This function determines if an operator is valid in starting
 // an expression. (i.e. *p = 2;)
-inline bool is_expr_op(const std::string& op) noexcept {
-    return op == "*" || op == "[";
+inline bool is_expr_op(TOKEN_KIND op) noexcept {
+    return op == KIND_STAR || op == KIND_LBRACKET;
 }
 
 // This function determines if a token type is a literal
@@ -162,73 +338,70 @@ inline bool is_literal(TOKEN_TYPE __type) noexcept {
            (__type == TOKEN_LIT_STRING);
 }
 
-// This function determines if a token type is an assignment operator.
-inline bool is_assignment_op(const std::string& op) noexcept {
-    return op == "=";
-}
-
-// This function determines if an operator is left associative.
-// inline bool is_left_assoc(const std::string& op) noexcept {
-//     return (op == "+") || (op == "*") ||
-//            (op == "&") || (op == "==") ||
-//            (op == "[") || (op == "//") ||;
-// }
-
 // This function determines if an operator is right associative.
-inline bool is_right_assoc(const std::string& op) noexcept {
-    return (op == "=") || (op == "+=") || (op == "-=") ||
-           (op == "*=") || (op == "%=") ||
-           (op == "@") || (op == "de") ||
-           (op == "!");
+inline bool is_right_assoc(OPERATOR_TYPE op) noexcept {
+    return (op == OPER_ASSIGN) || (op == OPER_ADDR) ||
+           (op == OPER_DEREF) || (op == OPER_NOT);
 }
 
 // This function determines if an operator is unary.
-inline bool is_unary_op(const std::string& op) noexcept {
-    return (op == "*") || (op == "@") ||
-           (op == "!");
+inline bool is_unary_op(TOKEN_KIND op) noexcept {
+    return (op == KIND_STAR) || (op == KIND_AT) ||
+           (op == KIND_NOT);
 }
 
-// This function determines if an evaluator op is unary.
-inline bool is_unary_eval_op(const std::string& op) noexcept {
-    return (op == "de") || (op == "@") ||
-           (op == "!");
+// This function determines if a resolved operator is unary.
+inline bool is_unary_oper(OPERATOR_TYPE op) noexcept {
+    return (op == OPER_DEREF) || (op == OPER_ADDR) ||
+           (op == OPER_NOT);
 }
 
 /******************************************************************************/
 
-// This function returns the index of the next occurence of a given
-// token.
-size_t find_nextof(const std::deque<std::shared_ptr<Token_T>>& __tokens,
-                    size_t __start_idx, const std::string& __token);
+// This defines the tokens find_nextof can search for.
+enum FIND_TOKEN {
+    FIND_SEMI,              // ;
+    FIND_COMMA,             // ,
+    FIND_PAREN,             // (
+    FIND_BRACE,             // {
+    FIND_COUNT,
+};
 
-// This function finds the corredsponding bracket, paren, brace, etc.
-size_t find_matching_ctrl(const std::deque<std::shared_ptr<Token_T>>& __tokens,
-                            size_t __start_idx, const std::string& __token);
+// This struct holds the lookup tables of a token table, so that the
+// parser never has to rescan tokens to find a closure or terminator.
+// Every table holds 0 where there is no such token.
+struct TokenIndex_T {
 
-/******************************************************************************/
+    // The matching closing token of every opening bracket, paren and
+    // brace.
+    std::vector<uint32_t> _match;
 
-// This struct contains information based on the new objects we form
-// which includes an addressable object, a non-addressable object, and
-// a recursive index.
-struct ObjectForm_T {
+    // For each token to search for, and each start index, the index of
+    // the next such token outside of any closure opened at or after
+    // the start. These hold one more entry than the token table.
+    std::vector<uint32_t> _next[FIND_COUNT];
 
-    std::shared_ptr<RoskyInterface>* _obj_adr;
-    std::shared_ptr<RoskyInterface> _obj;
-    size_t _recursive_index;
+};
 
-    ObjectForm_T(std::shared_ptr<RoskyInterface>* __obj_adr,
-                 const std::shared_ptr<RoskyInterface>& __obj,
-                 size_t __r_index)
-                 : _obj_adr(__obj_adr), _obj(__obj), _recursive_index(__r_index) {}
+// This function builds the lookup tables of a token table.
+TokenIndex_T index_tokens(const TokenTable_T& __tokens);
 
-};
+// This function returns the index of the next occurence of a given
+// token.
+size_t find_nextof(const TokenIndex_T& __index, size_t __start_idx, TOKEN_KIND __kind);
+
+// This function finds the corresponding bracket, paren or brace of the
+// one at the given index.
+inline size_t find_matching_ctrl(const TokenIndex_T& __index, size_t __start_idx) noexcept {
+    return __index._match[__start_idx];
+}
 
 /******************************************************************************/
 
-// This function forms objects out of a token.
-std::shared_ptr<ObjectForm_T> form_object(const std::shared_ptr<Token_T>& __token,
-                std::unique_ptr<VariableTable_T>& __var_table,
-                size_t __scope, size_t __r_index);
+// This function forms the object a literal token or value keyword
+// stands for, given its kind and text. Returns an empty value if the
+// token does not form an object, or is a number out of range.
+RoskyValue form_object(TOKEN_KIND __kind, const std::string& __text);
 
 /******************************************************************************/
 
@@ -5,11 +5,13 @@
 //
 //  Description:                This file is responsible managing the
 //                              variable/symbol table. It contains
-//                              functions to get and set different
-//                              entries in the table.
+//                              functions to push and pop the variable
+//                              slots of each frame.
 // 
-//                              The data structure for the variable
-//                              table is a deque.
+//                              Variables are resolved to a slot index by
+//                              the compiler, so the table is a single
+//                              stack of slots that every frame takes a
+//                              contiguous run of.
 //
 //  Dependencies:               rosky_interface.hpp
 //
@@ -18,8 +20,9 @@
 //
 //  Inherited Subprograms:      None
 //
-//  Exported Subprograms:       get_entry
-//                              set_entry
+//  Exported Subprograms:       reserve
+//                              push_frame
+//                              pop_frame
 //                              
 /******************************************************************************/
 
@@ -29,33 +32,23 @@
 /******************************************************************************/
 
 #include <memory>                   // std::shared_ptr
-#include <string>                   // std::string
-#include <utility>                  // std::pair
-#include <list>                     // std::list
-#include <iterator>                 // std::next
-
-#include <iostream>
+#include <vector>                   // std::vector
 
 #include "objects/rosky_interface.hpp"
 
 /******************************************************************************/
 
-// This struct defines an entry in the variable table.
+// This struct defines a variable slot. A slot is unbound while its
+// value is empty.
 struct VariableEntry_T {
 
-    std::string _name;
-    std::shared_ptr<RoskyInterface> _obj;
-    size_t _scope;
+    RoskyValue _obj;
 
-    // The recursive index allows us to know the recursion depth
-    // of a variable to dictate overwrite rules.
-    size_t _recurisve_index;
+    // The scope depth within the frame the slot was bound at, which
+    // dictates when it is released.
+    size_t _scope;
 
-    VariableEntry_T(const std::string& __name,
-                    const std::shared_ptr<RoskyInterface>& __obj,
-                    size_t __scope, size_t __r_index)
-                    : _name(__name), _obj(__obj),
-                    _scope(__scope), _recurisve_index(__r_index) {}
+    VariableEntry_T() : _scope(0) {}
 
 };
 
@@ -64,35 +57,35 @@ struct VariableEntry_T {
 // This class manages the variable table.
 class VariableTable_T {
 
-    // The variable table is saved as a linked list so
-    // if the table grows or shrinks during evaluation,
-    // it won't reallocate when addresses are sensitive.
-    std::list<VariableEntry_T> var_table;
+    // The slot stack is allocated once by reserve and never grows, as
+    // pointers to the slots must stay valid.
+    std::vector<VariableEntry_T> _slots;
+
+    // The number of slots currently pushed.
+    size_t _top;
 
 public:
 
-    VariableTable_T() {}
-    
-    // This function sets an entry within the variable table, overwriting
-    // the previous entry.
-    void set_entry(const std::string& __var_name,
-                          const std::shared_ptr<RoskyInterface>& __val,
-                          size_t __scope, size_t __r_index) noexcept;
+    VariableTable_T() : _top(0) {}
 
-    // This function returns a pointer to the object of the entry
-    // with a given name, or nullptr if the entry does not exist.
-    // It also returns the entries recursion depth.
-    std::pair<std::shared_ptr<RoskyInterface>*, size_t>
-        get_entry(const std::string& __var_name) noexcept;
+    // This function allocates the slot stack. It must be large enough
+    // for every frame that will be pushed at once.
+    void reserve(size_t __num_slots) noexcept;
 
-    // This function releases all variables above and including a given
-    // scope.
-    void release_above_scope(size_t __scope) noexcept;
+    // This function pushes a frame with a given number of slots, all
+    // unbound, and returns its slots.
+    inline VariableEntry_T* push_frame(size_t __num_slots) noexcept {
+        VariableEntry_T* frame = _slots.data() + _top;
+        _top += __num_slots;
+        return frame;
+    }
+
+    // This function unbinds the slots of the top frame, which has a
+    // given number of slots, and pops it.
+    void pop_frame(size_t __num_slots) noexcept;
 
 };
 
 /******************************************************************************/
 
 #endif // VARIABLE_HANDLER
-
-
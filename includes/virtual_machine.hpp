@@ -0,0 +1,176 @@
+/******************************************************************************/
+//
+//  Source Name:                virtual_machine.hpp
+//
+//  Description:                This file is responsible for executing
+//                              the bytecode generated by the compiler.
+//                              Instructions are dispatched from a single
+//                              loop, and user function calls push a
+//                              frame onto the frame stack rather than
+//                              recursing.
+//
+//                              The virtual machine will catch logical
+//                              errors that can only be known at runtime.
+//
+//                              This file also owns the instances
+//                              of the variable and function handler
+//                              backends.
+//
+//  Dependencies:               compiler_utils.hpp
+//                              parser_utils.hpp
+//                              error_handler.hpp
+//                              variable_handler.hpp
+//                              function_handler.hpp
+//                              rosky_interface.hpp
+//
+//  Classes:                    VirtualMachine_T
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       Ctor.
+//                              run
+//
+/******************************************************************************/
+
+#ifndef VIRTUAL_MACHINE
+#define VIRTUAL_MACHINE
+
+/******************************************************************************/
+
+#include <algorithm>                    // std::max
+#include <iterator>                     // std::make_move_iterator
+#include <memory>                       // std::shared_ptr, std::unique_ptr
+#include <utility>                      // std::pair
+#include <vector>                       // std::vector
+
+#include "utils/compiler_utils.hpp"
+#include "utils/parser_utils.hpp"
+
+#include "error_handler.hpp"
+#include "variable_handler.hpp"
+#include "function_handler.hpp"
+
+#include "objects/rosky_interface.hpp"
+#include "objects/rosky_null.hpp"
+#include "objects/rosky_pointer.hpp"
+#include "objects/rosky_group.hpp"
+
+/******************************************************************************/
+
+// The maximum depth of nested user function calls.
+#define MAX_CALL_DEPTH 999
+
+/******************************************************************************/
+
+// This class provides the definition for the virtual machine object. It
+// holds the runtime state of the program.
+class VirtualMachine_T {
+
+public:
+
+    // Type definitions.
+    typedef RoskyValue                          obj;
+    typedef std::pair<obj*, obj>                obj_pair;
+
+private:
+
+    // This struct defines an activation record of a chunk.
+    struct Frame_T {
+
+        // The chunk being executed, and the instruction to resume at.
+        const Chunk_T* _chunk;
+        size_t _ip;
+
+        // The frame's variable slots, which start with the arguments.
+        VariableEntry_T* _locals;
+
+        // The height of the iterator and operand stacks at entry. The
+        // return value is pushed at the operand stack's base.
+        size_t _iter_base;
+        size_t _stack_base;
+
+    };
+
+    // This struct defines the state of a for loop's iteration.
+    // The iterable keeps the object alive, and its box is iterated
+    // directly.
+    struct Iter_T {
+
+        obj _iterable;
+        RoskyInterface* _box;
+        size_t _pos;
+
+    };
+
+    // The variable table handler instance.
+    std::unique_ptr<VariableTable_T> _var_table;
+
+    // The function table handler instance.
+    std::unique_ptr<FunctionTable_T> _func_table;
+
+    // The operand stack.
+    std::vector<obj_pair> _stack;
+
+    // The iterator stack of the active for loops.
+    std::vector<Iter_T> _iters;
+
+    // The frame stack. Its size is the depth of function calls.
+    std::vector<Frame_T> _frames;
+
+public:
+
+    // Ctor.
+    VirtualMachine_T() {
+
+        // Instantiate the variable handler.
+        _var_table = std::make_unique<VariableTable_T>();
+
+        // Instantiate the function handler.
+        _func_table = std::make_unique<FunctionTable_T>();
+
+    }
+
+    // This function executes a compiled program until its main chunk
+    // returns.
+    void run(const std::shared_ptr<Chunk_T>& __chunk);
+
+private:
+
+    // This helper function pops the top of the operand stack.
+    inline obj_pair pop() noexcept {
+        obj_pair top = std::move(_stack.back());
+        _stack.pop_back();
+        return top;
+    }
+
+    // This helper function pops the top __count objects off of the
+    // operand stack, in the order they were pushed.
+    std::vector<obj> pop_args(size_t __count);
+
+    // This function returns the most slots any function nested within
+    // a chunk needs.
+    size_t max_func_slots(const Chunk_T* __chunk) const noexcept;
+
+    // This function looks a variable up by symbol id in the calling
+    // frames. Returns nullptr if it is not bound in any of them.
+    obj* find_name(size_t __symbol) noexcept;
+
+    // This function performs a binary or unary operator instruction.
+    obj_pair operate(OPCODE_TYPE __op, size_t __col, size_t __lin);
+
+    // This function defines a user function from a nested chunk.
+    void define_func(const std::shared_ptr<Chunk_T>& __func, size_t __col, size_t __lin);
+
+    // This helper function determines if a string is reserved.
+    inline bool is_reserved(const std::string& n) const noexcept {
+        return _func_table->is_function(n) || _func_table->is_member_function(n) ||
+               _func_table->is_user_function(n) || is_keyword(n);
+    }
+
+};
+
+/******************************************************************************/
+
+#endif // VIRTUAL_MACHINE
+
+/******************************************************************************/
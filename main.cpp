@@ -10,10 +10,26 @@
 //
 //                              Upon success, the input file is
 //                              converted to a source object
-//                              and lexing may begin.
+//                              and lexing may begin. The token
+//                              table is parsed once into a
+//                              statement tree, which is compiled
+//                              to bytecode and run by the
+//                              virtual machine.
+//
+//                              With the cache option, the bytecode is
+//                              loaded from the source's cache file when
+//                              the source is unchanged, and written to
+//                              it otherwise. With the pool stats option,
+//                              the hit rates of the object pools are
+//                              reported at exit.
 //
 //  Dependencies:               source_handler.hpp
+//                              cache_handler.hpp
+//                              pool_handler.hpp
 //                              lexer.hpp
+//                              parser.hpp
+//                              compiler.hpp
+//                              virtual_machine.hpp
 //
 //  Classes:                    None
 //
@@ -25,11 +41,16 @@
 
 #include <cstdio>               // printf, fprintf
 #include <fstream>              // std::ifstream
-#include <string.h>             // strlen
+#include <string.h>             // strlen, strcmp
 #include <memory>               // std::unique_ptr, std::make_unique
 
 #include "includes/source_handler.hpp"
+#include "includes/cache_handler.hpp"
+#include "includes/pool_handler.hpp"
 #include "includes/lexer.hpp"
+#include "includes/parser.hpp"
+#include "includes/compiler.hpp"
+#include "includes/virtual_machine.hpp"
 
 /******************************************************************************/
 
@@ -45,22 +66,52 @@ enum CMD_LINE_STATUS {
 
 /******************************************************************************/
 
+// The command line options, which precede the file path. They enable
+// the compiled program cache, and the report of the object pools.
+#define CACHE_OPTION "--cache"
+#define POOL_STATS_OPTION "--pool-stats"
+
+// This struct holds the options given on the command line.
+struct Options_T {
+    bool _cache;
+    bool _pool_stats;
+};
+
+/******************************************************************************/
+
 // This function is responsible for taking args from stdin and
-// returning a status.
-CMD_LINE_STATUS arg_parser(int argc, char* argv[]) {
+// returning a status. The file path and the options given are returned
+// through __file and __options.
+CMD_LINE_STATUS arg_parser(int argc, char* argv[], char*& __file, Options_T& __options) {
 
     // Check if the number of arguments is incorrect.
-    if (argc != 2) {
+    if (argc < 2) {
         return BAD_ARGS;
     }
 
+    // Every argument before the file path must be an option.
+    __options = {false, false};
+    for (int i = 1; i < argc - 1; i++) {
+
+        if (strcmp(argv[i], CACHE_OPTION) == 0) {
+            __options._cache = true;
+        } else if (strcmp(argv[i], POOL_STATS_OPTION) == 0) {
+            __options._pool_stats = true;
+        } else {
+            return BAD_ARGS;
+        }
+
+    }
+
+    __file = argv[argc - 1];
+
     // Set a temporary string to check against the provided
     // file extension.
     char ext[] = ".rosky";
 
     // Attempt to open the file.
     std::ifstream in_file;
-    in_file.open(argv[1]);
+    in_file.open(__file);
 
     // If the file did not open, it could not be found.
     if (!in_file.is_open()) {
@@ -73,15 +124,15 @@ CMD_LINE_STATUS arg_parser(int argc, char* argv[]) {
     // If the length of the filename is less than
     // the length of the extension, it cannot be a legal
     // filename.
-    if (strlen(argv[1]) < strlen(ext)) {
+    if (strlen(__file) < strlen(ext)) {
         return INVALID_FILE_TYPE;
     }
 
     // Check the file extension.
     size_t ext_index = 0;
-    for (size_t i = strlen(argv[1]) - strlen(ext); i < strlen(argv[1]); i++) {
+    for (size_t i = strlen(__file) - strlen(ext); i < strlen(__file); i++) {
 
-        if (argv[1][i] != ext[ext_index++]) {
+        if (__file[i] != ext[ext_index++]) {
             return INVALID_FILE_TYPE;
         }
 
@@ -96,7 +147,7 @@ CMD_LINE_STATUS arg_parser(int argc, char* argv[]) {
 
 // This function takes in a cmd status and responds accordingly.
 // This function will terminate execution if the status is not OK.
-void status_response(CMD_LINE_STATUS __status, char* argv[]) {
+void status_response(CMD_LINE_STATUS __status, const char* __file) {
 
     // If the status is ok, return.
     if (__status == OK) { return; }
@@ -105,13 +156,13 @@ void status_response(CMD_LINE_STATUS __status, char* argv[]) {
     if (__status == BAD_ARGS) {
         fprintf(stderr, "Bad arguments\n");
     } else if (__status == FILE_NOT_FOUND) {
-        fprintf(stderr, "File not found: '%s'\n", argv[1]);
+        fprintf(stderr, "File not found: '%s'\n", __file);
     } else if (__status == INVALID_FILE_TYPE) {
         fprintf(stderr, "Invalid file type\n");
     }
 
     fprintf(stderr, "Format: $ ");
-    fprintf(stderr, "rosky.exe [filepath].rosky\n");
+    fprintf(stderr, "rosky.exe [" CACHE_OPTION "] [" POOL_STATS_OPTION "] [filepath].rosky\n");
 
     exit(1);
 
@@ -122,17 +173,63 @@ void status_response(CMD_LINE_STATUS __status, char* argv[]) {
 int main(int argc, char* argv[]) {
 
     // Parse the command line arguments and get a status.
-    CMD_LINE_STATUS status = arg_parser(argc, argv);
+    char* file = nullptr;
+    Options_T options;
+    CMD_LINE_STATUS status = arg_parser(argc, argv, file, options);
 
     // Respond to errors. This function will terminate the
     // program on it's own if status is not OK.
-    status_response(status, argv);
+    status_response(status, file);
+
+    // Report the object pools at exit, including on an error.
+    if (options._pool_stats) {
+        enable_pool_stats();
+    }
 
     // Create the main source object.
-    std::unique_ptr<Src_T> main_src = std::make_unique<Src_T>(argv[1]);
+    std::unique_ptr<Src_T> main_src = std::make_unique<Src_T>(file);
+
+    // Load the bytecode from the cache if the source is unchanged.
+    std::string cache_path;
+    uint64_t src_hash = 0;
+    std::shared_ptr<Chunk_T> main_chunk;
+
+    if (options._cache) {
+        cache_path = get_cache_path(file);
+        src_hash = hash_src(*main_src);
+        main_chunk = load_cache(cache_path, src_hash);
+    }
+
+    if (main_chunk == nullptr) {
+
+        // Pass the main source into the lexer.
+        auto tokens = tokenize_src(main_src);
+
+        // Instantiate the parser object.
+        Parser_T main_parser(tokens);
+
+        // Parse the whole token table into the program's statements.
+        // Start index -> 0
+        // end index -> tokens.size()
+        auto program = main_parser.parse(0, tokens.size());
+
+        // Compile the program into bytecode.
+        Compiler_T main_compiler(tokens);
+        main_chunk = main_compiler.compile(program, main_parser.get_arena());
+
+        // Cache the bytecode for the next run.
+        if (options._cache) {
+            save_cache(cache_path, src_hash, *main_chunk);
+        }
+
+    }
+
+    // The source is no longer needed once the program is compiled.
+    main_src->clean();
 
-    // Pass the main source into the lexer.
-    tokenize_src(main_src);
+    // Run the program.
+    VirtualMachine_T main_vm;
+    main_vm.run(main_chunk);
 
     // Return successful.
     return 0;
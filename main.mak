@@ -23,27 +23,41 @@ OUTFILE=$(OUTDIR)/rosky.exe
 CFG_INC=
 CFG_LIB=
 CFG_OBJ=
-COMMON_OBJ=$(OUTDIR)/evaluator.o $(OUTDIR)/function_handler.o \
-	$(OUTDIR)/lexer.o $(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
-	$(OUTDIR)/native_member_functions.o $(OUTDIR)/parse_expr.o \
+COMMON_OBJ=$(OUTDIR)/cache_handler.o $(OUTDIR)/compiler.o \
+	$(OUTDIR)/fold_expr.o $(OUTDIR)/function_handler.o \
+	$(OUTDIR)/lexer.o \
+	$(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
+	$(OUTDIR)/native_member_functions.o $(OUTDIR)/output_handler.o \
+	$(OUTDIR)/parse_expr.o \
 	$(OUTDIR)/parse_for.o $(OUTDIR)/parse_func.o \
 	$(OUTDIR)/parse_func_def.o $(OUTDIR)/parse_group.o \
 	$(OUTDIR)/parse_if.o $(OUTDIR)/parse_while.o $(OUTDIR)/parser.o \
-	$(OUTDIR)/parser_utils.o $(OUTDIR)/rosky_bool.o \
+	$(OUTDIR)/parser_utils.o $(OUTDIR)/pool_handler.o \
+	$(OUTDIR)/rosky_bool.o \
 	$(OUTDIR)/rosky_float.o $(OUTDIR)/rosky_group.o \
 	$(OUTDIR)/rosky_int.o $(OUTDIR)/rosky_null.o \
-	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_string.o 
+	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_range.o \
+	$(OUTDIR)/rosky_string.o \
+	$(OUTDIR)/rosky_value.o \
+	$(OUTDIR)/virtual_machine.o
 OBJ=$(COMMON_OBJ) $(CFG_OBJ)
-ALL_OBJ=$(OUTDIR)/evaluator.o $(OUTDIR)/function_handler.o \
-	$(OUTDIR)/lexer.o $(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
-	$(OUTDIR)/native_member_functions.o $(OUTDIR)/parse_expr.o \
+ALL_OBJ=$(OUTDIR)/cache_handler.o $(OUTDIR)/compiler.o \
+	$(OUTDIR)/fold_expr.o $(OUTDIR)/function_handler.o \
+	$(OUTDIR)/lexer.o \
+	$(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
+	$(OUTDIR)/native_member_functions.o $(OUTDIR)/output_handler.o \
+	$(OUTDIR)/parse_expr.o \
 	$(OUTDIR)/parse_for.o $(OUTDIR)/parse_func.o \
 	$(OUTDIR)/parse_func_def.o $(OUTDIR)/parse_group.o \
 	$(OUTDIR)/parse_if.o $(OUTDIR)/parse_while.o $(OUTDIR)/parser.o \
-	$(OUTDIR)/parser_utils.o $(OUTDIR)/rosky_bool.o \
+	$(OUTDIR)/parser_utils.o $(OUTDIR)/pool_handler.o \
+	$(OUTDIR)/rosky_bool.o \
 	$(OUTDIR)/rosky_float.o $(OUTDIR)/rosky_group.o \
 	$(OUTDIR)/rosky_int.o $(OUTDIR)/rosky_null.o \
-	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_string.o 
+	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_range.o \
+	$(OUTDIR)/rosky_string.o \
+	$(OUTDIR)/rosky_value.o \
+	$(OUTDIR)/virtual_machine.o
 
 COMPILE=g++ -c    -g -o "$(OUTDIR)/$(*F).o" $(CFG_INC) "$<"
 LINK=g++  -g -o "$(OUTFILE)" $(OBJ) $(CFG_LIB)
@@ -192,27 +206,41 @@ OUTFILE=$(OUTDIR)/rosky.exe
 CFG_INC=
 CFG_LIB=
 CFG_OBJ=
-COMMON_OBJ=$(OUTDIR)/evaluator.o $(OUTDIR)/function_handler.o \
-	$(OUTDIR)/lexer.o $(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
-	$(OUTDIR)/native_member_functions.o $(OUTDIR)/parse_expr.o \
+COMMON_OBJ=$(OUTDIR)/cache_handler.o $(OUTDIR)/compiler.o \
+	$(OUTDIR)/fold_expr.o $(OUTDIR)/function_handler.o \
+	$(OUTDIR)/lexer.o \
+	$(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
+	$(OUTDIR)/native_member_functions.o $(OUTDIR)/output_handler.o \
+	$(OUTDIR)/parse_expr.o \
 	$(OUTDIR)/parse_for.o $(OUTDIR)/parse_func.o \
 	$(OUTDIR)/parse_func_def.o $(OUTDIR)/parse_group.o \
 	$(OUTDIR)/parse_if.o $(OUTDIR)/parse_while.o $(OUTDIR)/parser.o \
-	$(OUTDIR)/parser_utils.o $(OUTDIR)/rosky_bool.o \
+	$(OUTDIR)/parser_utils.o $(OUTDIR)/pool_handler.o \
+	$(OUTDIR)/rosky_bool.o \
 	$(OUTDIR)/rosky_float.o $(OUTDIR)/rosky_group.o \
 	$(OUTDIR)/rosky_int.o $(OUTDIR)/rosky_null.o \
-	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_string.o 
+	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_range.o \
+	$(OUTDIR)/rosky_string.o \
+	$(OUTDIR)/rosky_value.o \
+	$(OUTDIR)/virtual_machine.o
 OBJ=$(COMMON_OBJ) $(CFG_OBJ)
-ALL_OBJ=$(OUTDIR)/evaluator.o $(OUTDIR)/function_handler.o \
-	$(OUTDIR)/lexer.o $(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
-	$(OUTDIR)/native_member_functions.o $(OUTDIR)/parse_expr.o \
+ALL_OBJ=$(OUTDIR)/cache_handler.o $(OUTDIR)/compiler.o \
+	$(OUTDIR)/fold_expr.o $(OUTDIR)/function_handler.o \
+	$(OUTDIR)/lexer.o \
+	$(OUTDIR)/main.o $(OUTDIR)/native_functions.o \
+	$(OUTDIR)/native_member_functions.o $(OUTDIR)/output_handler.o \
+	$(OUTDIR)/parse_expr.o \
 	$(OUTDIR)/parse_for.o $(OUTDIR)/parse_func.o \
 	$(OUTDIR)/parse_func_def.o $(OUTDIR)/parse_group.o \
 	$(OUTDIR)/parse_if.o $(OUTDIR)/parse_while.o $(OUTDIR)/parser.o \
-	$(OUTDIR)/parser_utils.o $(OUTDIR)/rosky_bool.o \
+	$(OUTDIR)/parser_utils.o $(OUTDIR)/pool_handler.o \
+	$(OUTDIR)/rosky_bool.o \
 	$(OUTDIR)/rosky_float.o $(OUTDIR)/rosky_group.o \
 	$(OUTDIR)/rosky_int.o $(OUTDIR)/rosky_null.o \
-	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_string.o 
+	$(OUTDIR)/rosky_pointer.o $(OUTDIR)/rosky_range.o \
+	$(OUTDIR)/rosky_string.o \
+	$(OUTDIR)/rosky_value.o \
+	$(OUTDIR)/virtual_machine.o
 
 COMPILE=g++ -c   -o "$(OUTDIR)/$(*F).o" $(CFG_INC) "$<"
 LINK=g++  -o "$(OUTFILE)" $(OBJ) $(CFG_LIB)
@@ -0,0 +1,496 @@
+/******************************************************************************/
+//
+//  Source Name:                cache_handler.cpp
+//
+//  Description:                This file is responsible for the on-disk
+//                              cache of compiled programs.
+//
+//                              A cache file starts with a header holding
+//                              the file format, the interpreter version,
+//                              the source hash and size, and a checksum
+//                              of the chunks that follow. Every integer
+//                              is stored as a varint of 7 bits per byte,
+//                              low bits first, and every string as its
+//                              size followed by its bytes. Constants are
+//                              stored as their type followed by their
+//                              value. Function chunks are stored nested
+//                              in the chunk they are defined in.
+//
+//                              The file is written under a temporary
+//                              name and renamed into place, so a run never
+//                              reads a partly written cache.
+//
+//  Dependencies:               source_handler.hpp
+//                              compiler_utils.hpp
+//
+//  Classes:                    None
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       get_cache_path
+//                              hash_src
+//                              load_cache
+//                              save_cache
+//
+/******************************************************************************/
+
+#include <cstdio>                       // std::rename, std::remove
+#include <cstring>                      // memcmp, memcpy
+#include <fstream>                      // std::ifstream, std::ofstream
+#include <sstream>                      // std::stringstream
+
+#if defined(_WIN32)
+#include <process.h>                    // _getpid
+#else
+#include <unistd.h>                     // getpid
+#endif
+
+#include "../includes/cache_handler.hpp"
+
+/******************************************************************************/
+
+// The bytes every cache file starts with.
+static const char CACHE_MAGIC[4] = {'R', 'S', 'K', 'C'};
+
+// The FNV-1a parameters used for the source hash and checksum.
+static const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+/******************************************************************************/
+
+// This function returns the FNV-1a hash of __size bytes.
+static uint64_t hash_bytes(const char* __data, size_t __size) noexcept {
+
+    uint64_t h = FNV_OFFSET;
+    for (size_t i = 0; i < __size; i++) {
+        h = (h ^ (unsigned char)__data[i]) * FNV_PRIME;
+    }
+
+    return h;
+
+}
+
+/******************************************************************************/
+
+// These functions append an integer, a string or a position to the cache.
+static void write_int(std::string& __out, uint64_t __n) {
+
+    while (__n >= 0x80) {
+        __out.push_back((char)(__n | 0x80));
+        __n >>= 7;
+    }
+
+    __out.push_back((char)__n);
+
+}
+
+static void write_str(std::string& __out, const std::string& __s) {
+    write_int(__out, __s.size());
+    __out.append(__s);
+}
+
+static void write_pos(std::string& __out, const std::pair<size_t, size_t>& __pos) {
+    write_int(__out, __pos.first);
+    write_int(__out, __pos.second);
+}
+
+// This function appends a constant.
+static void write_const(std::string& __out, const RoskyValue& __obj) {
+
+    write_int(__out, __obj.get_type_id());
+
+    switch (__obj.get_type_id()) {
+
+        case OBJ_INT:
+            write_int(__out, (uint64_t)__obj.to_int());
+            break;
+
+        case OBJ_FLOAT: {
+            double data = __obj.to_float();
+            uint64_t bits;
+            memcpy(&bits, &data, sizeof(bits));
+            write_int(__out, bits);
+            break;
+        }
+
+        case OBJ_BOOL:
+            write_int(__out, __obj.to_bool());
+            break;
+
+        case OBJ_STRING:
+            write_str(__out, __obj.to_string());
+            break;
+
+        // Null and nullptr have no value.
+        default:
+            break;
+
+    }
+
+}
+
+// This function appends a chunk, followed by its nested function chunks.
+static void write_chunk(std::string& __out, const Chunk_T& __chunk) {
+
+    // The instructions and their source positions.
+    write_int(__out, __chunk._code.size());
+    for (size_t i = 0; i < __chunk._code.size(); i++) {
+        write_int(__out, __chunk._code[i]._op);
+        write_int(__out, __chunk._code[i]._a);
+        write_int(__out, __chunk._code[i]._b);
+        write_pos(__out, __chunk._pos[i]);
+    }
+
+    // The constant pool.
+    write_int(__out, __chunk._consts.size());
+    for (const auto& c : __chunk._consts) {
+        write_const(__out, c);
+    }
+
+    // The names and their symbol ids.
+    write_int(__out, __chunk._names.size());
+    for (size_t i = 0; i < __chunk._names.size(); i++) {
+        write_str(__out, __chunk._names[i]);
+        write_int(__out, __chunk._name_ids[i]);
+    }
+
+    // The slots and the symbols bound to them.
+    write_int(__out, __chunk._num_slots);
+    write_int(__out, __chunk._slot_map.size());
+    for (const auto& entry : __chunk._slot_map) {
+        write_int(__out, entry.first);
+        write_int(__out, entry.second.size());
+        for (size_t slot : entry.second) {
+            write_int(__out, slot);
+        }
+    }
+
+    // The release lists.
+    write_int(__out, __chunk._releases.size());
+    for (const auto& release : __chunk._releases) {
+        write_int(__out, release.size());
+        for (size_t slot : release) {
+            write_int(__out, slot);
+        }
+    }
+
+    // The function name and parameters.
+    write_str(__out, __chunk._func_name);
+    write_int(__out, __chunk._params.size());
+    for (size_t i = 0; i < __chunk._params.size(); i++) {
+        write_str(__out, __chunk._params[i]);
+        write_pos(__out, __chunk._param_pos[i]);
+    }
+
+    // The nested functions.
+    write_int(__out, __chunk._funcs.size());
+    for (const auto& func : __chunk._funcs) {
+        write_chunk(__out, *func);
+    }
+
+}
+
+/******************************************************************************/
+
+// This struct reads the contents of a cache file. Reading past the end
+// marks the reader as failed, after which every read returns zero.
+struct CacheReader_T {
+
+    const char* _data;
+    size_t _size;
+    size_t _pos;
+    bool _failed;
+
+    // Ctor.
+    CacheReader_T(const char* __data, size_t __size)
+        : _data(__data), _size(__size), _pos(0), _failed(false) {}
+
+    // This function returns if __n more bytes can be read.
+    bool has(uint64_t __n) noexcept {
+
+        if (_failed || __n > _size - _pos) {
+            _failed = true;
+        }
+
+        return !_failed;
+
+    }
+
+    uint64_t read_int() noexcept {
+
+        uint64_t n = 0;
+        for (int shift = 0; shift < 64 && has(1); shift += 7) {
+
+            unsigned char byte = _data[_pos++];
+            n |= (uint64_t)(byte & 0x7f) << shift;
+
+            if (byte < 0x80) {
+                return n;
+            }
+
+        }
+
+        _failed = true;
+        return 0;
+
+    }
+
+    std::string read_str() {
+
+        uint64_t len = read_int();
+        if (!has(len)) {
+            return std::string();
+        }
+
+        std::string s(_data + _pos, len);
+        _pos += len;
+        return s;
+
+    }
+
+    std::pair<size_t, size_t> read_pos() noexcept {
+        size_t col = read_int();
+        return {col, read_int()};
+    }
+
+    // This function reads the size of a list whose entries take at least
+    // __entry bytes each, so a damaged size cannot cause a huge allocation.
+    uint64_t read_count(uint64_t __entry) noexcept {
+
+        uint64_t n = read_int();
+        if (!_failed && n > (_size - _pos) / __entry) {
+            _failed = true;
+        }
+
+        return _failed ? 0 : n;
+
+    }
+
+};
+
+// This function reads a constant. Returns an empty value if the type
+// cannot be a constant.
+static RoskyValue read_const(CacheReader_T& __in) {
+
+    switch (__in.read_int()) {
+
+        case OBJ_INT:
+            return RoskyValue::make_int((long)__in.read_int());
+
+        case OBJ_FLOAT: {
+            uint64_t bits = __in.read_int();
+            double data;
+            memcpy(&data, &bits, sizeof(data));
+            return RoskyValue::make_float(data);
+        }
+
+        case OBJ_BOOL:
+            return RoskyValue::make_bool(__in.read_int() != 0);
+
+        case OBJ_STRING:
+            return RoskyValue::make_string(__in.read_str());
+
+        case OBJ_NULL:
+            return RoskyValue::make_null();
+
+        case OBJ_POINTER:
+            return RoskyValue::make_nullptr();
+
+        default:
+            return RoskyValue();
+
+    }
+
+}
+
+// This function reads a chunk, followed by its nested function chunks.
+// Returns nullptr if the contents are damaged.
+static std::shared_ptr<Chunk_T> read_chunk(CacheReader_T& __in) {
+
+    auto chunk = std::make_shared<Chunk_T>();
+
+    // The instructions and their source positions.
+    uint64_t n = __in.read_count(5);
+    chunk->_code.reserve(n);
+    chunk->_pos.reserve(n);
+    for (uint64_t i = 0; i < n; i++) {
+
+        uint64_t op = __in.read_int();
+        if (op > OP_ITER_END) {
+            return nullptr;
+        }
+
+        size_t a = __in.read_int();
+        size_t b = __in.read_int();
+        chunk->_code.emplace_back((OPCODE_TYPE)op, a, b);
+        chunk->_pos.push_back(__in.read_pos());
+
+    }
+
+    // The constant pool.
+    n = __in.read_count(1);
+    for (uint64_t i = 0; i < n; i++) {
+
+        RoskyValue obj = read_const(__in);
+        if (obj.is_empty()) {
+            return nullptr;
+        }
+
+        chunk->_consts.push_back(obj);
+
+    }
+
+    // The names and their symbol ids.
+    n = __in.read_count(2);
+    for (uint64_t i = 0; i < n; i++) {
+        chunk->_names.push_back(__in.read_str());
+        chunk->_name_ids.push_back(__in.read_int());
+    }
+
+    // The slots and the symbols bound to them.
+    chunk->_num_slots = __in.read_int();
+    n = __in.read_count(2);
+    for (uint64_t i = 0; i < n; i++) {
+
+        std::vector<size_t>& slots = chunk->_slot_map[__in.read_int()];
+        uint64_t count = __in.read_count(1);
+        for (uint64_t j = 0; j < count; j++) {
+            slots.push_back(__in.read_int());
+        }
+
+    }
+
+    // The release lists.
+    n = __in.read_count(1);
+    chunk->_releases.resize(n);
+    for (uint64_t i = 0; i < n; i++) {
+
+        uint64_t count = __in.read_count(1);
+        for (uint64_t j = 0; j < count; j++) {
+            chunk->_releases[i].push_back(__in.read_int());
+        }
+
+    }
+
+    // The function name and parameters.
+    chunk->_func_name = __in.read_str();
+    n = __in.read_count(3);
+    for (uint64_t i = 0; i < n; i++) {
+        chunk->_params.push_back(__in.read_str());
+        chunk->_param_pos.push_back(__in.read_pos());
+    }
+
+    // The nested functions.
+    n = __in.read_count(1);
+    for (uint64_t i = 0; i < n; i++) {
+
+        auto func = read_chunk(__in);
+        if (func == nullptr) {
+            return nullptr;
+        }
+
+        chunk->_funcs.push_back(func);
+
+    }
+
+    return __in._failed ? nullptr : chunk;
+
+}
+
+/******************************************************************************/
+
+// This function appends the header of a cache file, up to the checksum.
+static void write_header(std::string& __out, uint64_t __hash) {
+
+    __out.append(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    write_int(__out, CACHE_FORMAT);
+    write_str(__out, ROSKY_VERSION);
+    write_int(__out, __hash);
+
+}
+
+/******************************************************************************/
+
+std::string get_cache_path(const std::string& __filename) {
+    return __filename + CACHE_EXT;
+}
+
+uint64_t hash_src(const Src_T& __src) noexcept {
+    return hash_bytes(__src._data, __src._size);
+}
+
+/******************************************************************************/
+
+std::shared_ptr<Chunk_T> load_cache(const std::string& __path, uint64_t __hash) {
+
+    // Read in the whole file at once.
+    std::ifstream in_file(__path, std::ios::binary);
+    if (!in_file.is_open()) {
+        return nullptr;
+    }
+
+    std::stringstream contents;
+    contents << in_file.rdbuf();
+    std::string data = contents.str();
+
+    // The header must match exactly the one this run would write.
+    std::string header;
+    write_header(header, __hash);
+
+    if (data.size() < header.size() ||
+        memcmp(data.data(), header.data(), header.size()) != 0) {
+        return nullptr;
+    }
+
+    // The chunks must match their checksum.
+    CacheReader_T in(data.data() + header.size(), data.size() - header.size());
+    uint64_t checksum = in.read_int();
+
+    if (hash_bytes(in._data + in._pos, in._size - in._pos) != checksum) {
+        return nullptr;
+    }
+
+    auto chunk = read_chunk(in);
+    if (chunk == nullptr || in._pos != in._size) {
+        return nullptr;
+    }
+
+    return chunk;
+
+}
+
+/******************************************************************************/
+
+void save_cache(const std::string& __path, uint64_t __hash, const Chunk_T& __chunk) {
+
+    std::string chunks;
+    write_chunk(chunks, __chunk);
+
+    std::string data;
+    write_header(data, __hash);
+    write_int(data, hash_bytes(chunks.data(), chunks.size()));
+    data.append(chunks);
+
+    // Write to a name of this process's own, so that runs of the same
+    // source do not write over each other, then move it into place.
+#if defined(_WIN32)
+    std::string temp_path = __path + "." + std::to_string(_getpid());
+#else
+    std::string temp_path = __path + "." + std::to_string(getpid());
+#endif
+
+    std::ofstream out_file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out_file.is_open()) {
+        return;
+    }
+
+    out_file.write(data.data(), data.size());
+    out_file.close();
+
+    if (!out_file || std::rename(temp_path.c_str(), __path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+    }
+
+}
+
+/******************************************************************************/
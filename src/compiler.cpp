@@ -0,0 +1,604 @@
+/******************************************************************************/
+//
+//  Source Name:                compiler.cpp
+//
+//  Description:                This file is responsible for compiling
+//                              the statement tree generated by the parser
+//                              into bytecode for the virtual machine.
+//
+//                              Every user function is compiled into its
+//                              own chunk, which is nested in the chunk
+//                              it is defined in.
+//
+//                              Variables assigned within a chunk are
+//                              resolved to a slot of its frame, so the
+//                              virtual machine only looks a variable up
+//                              by name when it belongs to a caller.
+//
+//  Dependencies:               parser_utils.hpp
+//                              compiler_utils.hpp
+//                              error_handler.hpp
+//
+//  Classes:                    Compiler_T
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       compile
+//
+/******************************************************************************/
+
+#include "../includes/compiler.hpp"
+
+#include <algorithm>                    // std::sort, std::unique
+
+/******************************************************************************/
+
+std::shared_ptr<Chunk_T> Compiler_T::compile(const std::vector<std::shared_ptr<StmtNode>>& __stmts,
+                                             const std::shared_ptr<ExprArena_T>& __arena) {
+
+    // Create the main chunk.
+    _chunk = std::make_shared<Chunk_T>();
+    _arena = __arena.get();
+    _depth = 0;
+
+    // Allocate the slots of the program's variables.
+    declare_slots(__stmts);
+
+    // Compile the program, and end it with a return.
+    compile_stmts(__stmts);
+    emit(OP_RETURN, 0, 0, 0, 0);
+
+    return _chunk;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_stmts(const std::vector<std::shared_ptr<StmtNode>>& __stmts) {
+
+    for (auto& stmt : __stmts) {
+
+        switch (stmt->_type) {
+
+            case STMT_EXPR:
+                // The result of an expression statement is discarded.
+                compile_expr(stmt->_exprs[0]);
+                emit(OP_POP, 0, 0, stmt->_colnum, stmt->_linenum);
+                break;
+
+            case STMT_BLOCK: {
+                // Blocks increment the scope and release it on exit.
+                size_t mark = _stores.size();
+                compile_block(stmt, _depth + 1);
+                emit_release(_depth + 1, mark, stmt->_colnum, stmt->_linenum);
+                break;
+            }
+
+            case STMT_IF:
+                compile_if(stmt);
+                break;
+
+            case STMT_WHILE:
+                compile_while(stmt);
+                break;
+
+            case STMT_FOR:
+                compile_for(stmt);
+                break;
+
+            case STMT_FUNC_DEF:
+                compile_func_def(stmt);
+                break;
+
+            case STMT_RETURN:
+                // A bare return returns a null type.
+                if (stmt->_exprs.empty()) {
+                    emit(OP_RETURN, 0, 0, stmt->_colnum, stmt->_linenum);
+                } else {
+                    compile_expr(stmt->_exprs[0]);
+                    emit(OP_RETURN, 1, 0, stmt->_colnum, stmt->_linenum);
+                }
+                break;
+
+            case STMT_BREAK:
+                // The jump is patched to the loop exit once it is known.
+                _loops.back()._breaks.push_back(emit(OP_JUMP, 0, 0, stmt->_colnum, stmt->_linenum));
+                break;
+
+            case STMT_CONTINUE:
+                emit(OP_JUMP, _loops.back()._cont_target, 0, stmt->_colnum, stmt->_linenum);
+                break;
+
+        }
+
+    }
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_block(const std::shared_ptr<StmtNode>& __block, size_t __depth) {
+
+    // Bookmark the current depth.
+    size_t depth = _depth;
+
+    // Step into the block's scope and compile its statements.
+    _depth = __depth;
+    compile_stmts(__block->_stmts);
+
+    // Reset the depth.
+    _depth = depth;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_if(const std::shared_ptr<StmtNode>& __stmt) {
+
+    // Conditions are evaluated one scope in, and bodies two scopes in.
+    size_t depth = _depth;
+    size_t mark = _stores.size();
+    _depth = depth + 1;
+
+    // This holds the jumps out of each taken body, patched to the end.
+    std::vector<size_t> end_jumps;
+
+    for (size_t cond_idx = 0; cond_idx < __stmt->_exprs.size(); cond_idx++) {
+
+        // Evaluate the condition and skip the body if it is false.
+        compile_expr(__stmt->_exprs[cond_idx]);
+        size_t skip_jump = emit(OP_JUMP_IF_FALSE, 0, 0, __stmt->_expr_pos[cond_idx].first,
+                                __stmt->_expr_pos[cond_idx].second);
+
+        // Compile the body, then jump past the remaining bodies.
+        compile_block(__stmt->_stmts[cond_idx], depth + 2);
+        end_jumps.push_back(emit(OP_JUMP, 0, 0, __stmt->_colnum, __stmt->_linenum));
+
+        // A false condition continues with the next condition.
+        _chunk->_code[skip_jump]._a = _chunk->_code.size();
+
+    }
+
+    // If there is an extra body, this signifies the else.
+    if (__stmt->_stmts.size() > __stmt->_exprs.size()) {
+        compile_block(__stmt->_stmts.back(), depth + 2);
+    }
+
+    // Patch the jumps to the end, and release above the statement's scope.
+    for (auto& jump : end_jumps) {
+        _chunk->_code[jump]._a = _chunk->_code.size();
+    }
+    emit_release(depth + 1, mark, __stmt->_colnum, __stmt->_linenum);
+
+    // Reset the depth.
+    _depth = depth;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_while(const std::shared_ptr<StmtNode>& __stmt) {
+
+    // The condition is evaluated one scope in, and the body two scopes in.
+    size_t depth = _depth;
+    size_t mark = _stores.size();
+    _depth = depth + 1;
+
+    // The loop restarts at the condition, which is also where a continue
+    // jumps to.
+    size_t loop_start = _chunk->_code.size();
+    _loops.push_back({loop_start, {}});
+
+    // Evaluate the condition and leave the loop if it is false.
+    compile_expr(__stmt->_exprs[0]);
+    size_t exit_jump = emit(OP_JUMP_IF_FALSE, 0, 0, __stmt->_expr_pos[0].first, __stmt->_expr_pos[0].second);
+
+    // Compile the body and loop.
+    compile_block(__stmt->_stmts[0], depth + 2);
+    emit(OP_JUMP, loop_start, 0, __stmt->_colnum, __stmt->_linenum);
+
+    // Patch the exits, and release above the statement's scope.
+    _chunk->_code[exit_jump]._a = _chunk->_code.size();
+    for (auto& jump : _loops.back()._breaks) {
+        _chunk->_code[jump]._a = _chunk->_code.size();
+    }
+    _loops.pop_back();
+    emit_release(depth + 1, mark, __stmt->_colnum, __stmt->_linenum);
+
+    // Reset the depth.
+    _depth = depth;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_for(const std::shared_ptr<StmtNode>& __stmt) {
+
+    // The iterable is evaluated one scope in, and the body two scopes in.
+    size_t depth = _depth;
+    size_t mark = _stores.size();
+    _depth = depth + 1;
+
+    // The loop variable gets its own slot, so it shadows any variable of
+    // the same name until the loop ends.
+    size_t slot = add_slot(__stmt->_name);
+    _stores.push_back(slot);
+
+    // Evaluate the iterable and push it onto the iterator stack.
+    compile_expr(__stmt->_exprs[0]);
+    emit(OP_ITER_INIT, slot, depth + 1, __stmt->_expr_pos[0].first, __stmt->_expr_pos[0].second);
+
+    // The loop restarts by assigning the next element, which is also where
+    // a continue jumps to. The loop variable lives one scope in.
+    size_t loop_start = emit(OP_ITER_NEXT, slot, 0, __stmt->_colnum, __stmt->_linenum);
+    _loops.push_back({loop_start, {}});
+
+    // Compile the body and loop.
+    _iter_slots.push_back({__stmt->_name, slot});
+    compile_block(__stmt->_stmts[0], depth + 2);
+    _iter_slots.pop_back();
+    emit(OP_JUMP, loop_start, 0, __stmt->_colnum, __stmt->_linenum);
+
+    // Patch the exits, drop the iterator, and release above the
+    // statement's scope.
+    _chunk->_code[loop_start]._b = _chunk->_code.size();
+    for (auto& jump : _loops.back()._breaks) {
+        _chunk->_code[jump]._a = _chunk->_code.size();
+    }
+    _loops.pop_back();
+    emit(OP_ITER_END, 0, 0, __stmt->_colnum, __stmt->_linenum);
+    emit_release(depth + 1, mark, __stmt->_colnum, __stmt->_linenum);
+
+    // Reset the depth.
+    _depth = depth;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_func_def(const std::shared_ptr<StmtNode>& __stmt) {
+
+    // Bookmark the state of the enclosing chunk.
+    std::shared_ptr<Chunk_T> parent = _chunk;
+    const ExprArena_T* arena = _arena;
+    size_t depth = _depth;
+    std::vector<LoopInfo_T> loops;
+    loops.swap(_loops);
+    std::unordered_map<std::string, size_t> slots;
+    slots.swap(_slots);
+    std::vector<std::pair<std::string, size_t>> iter_slots;
+    iter_slots.swap(_iter_slots);
+    std::vector<size_t> stores;
+    stores.swap(_stores);
+    std::unordered_map<uint64_t, size_t> const_ids;
+    const_ids.swap(_const_ids);
+
+    // Create the function's chunk. Its body starts at the frame's scope.
+    _chunk = std::make_shared<Chunk_T>();
+    _chunk->_func_name = __stmt->_name;
+    _chunk->_params = __stmt->_params;
+    _chunk->_param_pos = __stmt->_param_pos;
+    _arena = __stmt->_arena.get();
+    _depth = 0;
+
+    // The parameters take the first slots, in order, followed by the
+    // function's variables.
+    for (auto& param : __stmt->_params) {
+        _slots[param] = add_slot(param);
+    }
+    declare_slots(__stmt->_stmts[0]->_stmts);
+
+    // Compile the body, and end it with a return of a null type.
+    compile_stmts(__stmt->_stmts[0]->_stmts);
+    emit(OP_RETURN, 0, 0, __stmt->_colnum, __stmt->_linenum);
+
+    // Restore the enclosing chunk and add the function to it.
+    std::shared_ptr<Chunk_T> func_chunk = _chunk;
+    _chunk = parent;
+    _arena = arena;
+    _depth = depth;
+    _loops.swap(loops);
+    _slots.swap(slots);
+    _iter_slots.swap(iter_slots);
+    _stores.swap(stores);
+    _const_ids.swap(const_ids);
+
+    _chunk->_funcs.push_back(func_chunk);
+    emit(OP_DEF_FUNC, _chunk->_funcs.size() - 1, 0, __stmt->_colnum, __stmt->_linenum);
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::compile_expr(node_idx __idx) {
+
+    const ParseNode& node = (*_arena)[__idx];
+
+    // The node's token holds its name and source position.
+    const std::string& name = _tokens.text(node._token);
+    size_t col = _tokens[node._token]._colnum;
+    size_t lin = _tokens[node._token]._linenum;
+
+    // Operands
+
+    if (node._type == PARSE_OPERAND) {
+
+        switch (node._operand) {
+
+            case OPERAND_LITERAL:
+            case OPERAND_CONST:
+                emit(OP_LOAD_CONST, add_const(node), 0, col, lin);
+                return;
+
+            case OPERAND_SYMBOL: {
+                // A variable assigned within the chunk is loaded from its
+                // slot, anything else must belong to a caller.
+                size_t slot = 0;
+                if (resolve_slot(name, slot)) {
+                    emit(OP_LOAD_LOCAL, slot, add_name(name), col, lin);
+                } else {
+                    emit(OP_LOAD_NAME, add_name(name), 0, col, lin);
+                }
+                return;
+            }
+
+            case OPERAND_CALL:
+                // Arguments are evaluated left to right.
+                for (size_t arg = 0; arg < node._nargs; arg++) {
+                    compile_expr(_arena->arg(node, arg));
+                }
+                emit(OP_CALL, add_name(name), node._nargs, col, lin);
+                return;
+
+            case OPERAND_MEMBER_CALL:
+                // The object is evaluated before the arguments.
+                compile_expr(node._target);
+                for (size_t arg = 0; arg < node._nargs; arg++) {
+                    compile_expr(_arena->arg(node, arg));
+                }
+                emit(OP_CALL_MEMBER, add_name(name), node._nargs, col, lin);
+                return;
+
+            case OPERAND_GROUP:
+                for (size_t elem = 0; elem < node._nargs; elem++) {
+                    compile_expr(_arena->arg(node, elem));
+                }
+                emit(OP_MAKE_GROUP, node._nargs, 0, col, lin);
+                return;
+
+            case OPERAND_EXPR:
+                compile_expr(node._target);
+                return;
+
+            default:
+                return;
+
+        }
+
+    }
+
+    // Operators
+
+    // Assignments evaluate the right side first, since the left side
+    // may not exist yet.
+    if (node._oper == OPER_ASSIGN) {
+
+        compile_expr(node._right);
+
+        // A symbol is stored to its slot, which is bound at the current
+        // depth if it is not bound yet. Anything else must evaluate to
+        // an addressable object.
+        const ParseNode& left = (*_arena)[node._left];
+        if (left._operand == OPERAND_SYMBOL) {
+            size_t slot = 0;
+            resolve_slot(_tokens.text(left._token), slot);
+            emit(OP_STORE_LOCAL, slot, _depth, col, lin);
+            _stores.push_back(slot);
+        } else {
+            compile_expr(node._left);
+            emit(OP_STORE_REF, 0, 0, col, lin);
+        }
+        return;
+
+    }
+
+    // Unary operators only have a right side.
+    if (is_unary_oper(node._oper)) {
+
+        compile_expr(node._right);
+        emit(get_opcode(node._oper), 0, 0, col, lin);
+        return;
+
+    }
+
+    // The right side of and/or is skipped when the left side decides
+    // the result.
+    if (node._oper == OPER_AND || node._oper == OPER_OR) {
+
+        compile_expr(node._left);
+        size_t jump = emit(node._oper == OPER_AND ? OP_JUMP_AND : OP_JUMP_OR, 0, 0, col, lin);
+        compile_expr(node._right);
+        emit(get_opcode(node._oper), 0, 0, col, lin);
+
+        _chunk->_code[jump]._a = _chunk->_code.size();
+        return;
+
+    }
+
+    // Binary operators evaluate left to right.
+    compile_expr(node._left);
+    compile_expr(node._right);
+    emit(get_opcode(node._oper), 0, 0, col, lin);
+
+}
+
+/******************************************************************************/
+
+size_t Compiler_T::emit(OPCODE_TYPE __op, size_t __a, size_t __b, size_t __col, size_t __lin) {
+
+    _chunk->_code.emplace_back(__op, __a, __b);
+    _chunk->_pos.push_back({__col, __lin});
+
+    return _chunk->_code.size() - 1;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::emit_release(size_t __depth, size_t __mark, size_t __col, size_t __lin) {
+
+    // Any slot stored to within the statement may have been bound within
+    // it, so each one is checked at runtime.
+    std::vector<size_t> slots(_stores.begin() + __mark, _stores.end());
+    std::sort(slots.begin(), slots.end());
+    slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
+
+    _chunk->_releases.push_back(slots);
+    emit(OP_RELEASE, __depth, _chunk->_releases.size() - 1, __col, __lin);
+
+}
+
+/******************************************************************************/
+
+size_t Compiler_T::add_name(const std::string& __name) {
+
+    // Reuse the name if the chunk already references it.
+    for (size_t idx = 0; idx < _chunk->_names.size(); idx++) {
+        if (_chunk->_names[idx] == __name) {
+            return idx;
+        }
+    }
+
+    _chunk->_names.push_back(__name);
+    _chunk->_name_ids.push_back(get_symbol(__name));
+    return _chunk->_names.size() - 1;
+
+}
+
+/******************************************************************************/
+
+size_t Compiler_T::add_const(const ParseNode& __node) {
+
+    const Token_T& token = _tokens[__node._token];
+    bool folded = __node._operand == OPERAND_CONST;
+
+    // Reuse the constant if the chunk already has the same literal.
+    uint64_t key = folded ? ((uint64_t)1 << 63) | __node._args
+                          : ((uint64_t)token._kind << 32) | token._id;
+    auto it = _const_ids.find(key);
+    if (it != _const_ids.end()) {
+        return it->second;
+    }
+
+    // Form the literal's object once, for every load to share. Folded
+    // constants are already formed.
+    RoskyValue obj = folded ? _arena->_consts[__node._args]
+                            : form_object(token._kind, _tokens.text(__node._token));
+    if (obj.is_empty()) {
+        throw_error(ERR_LIT_RANGE, _tokens.text(__node._token), token._colnum, token._linenum);
+    }
+
+    _chunk->_consts.push_back(obj);
+    _const_ids[key] = _chunk->_consts.size() - 1;
+    return _chunk->_consts.size() - 1;
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::declare_slots(const std::vector<std::shared_ptr<StmtNode>>& __stmts) {
+
+    for (auto& stmt : __stmts) {
+
+        // Functions have their own frame.
+        if (stmt->_type == STMT_FUNC_DEF) {
+            continue;
+        }
+
+        for (auto& expr : stmt->_exprs) {
+            declare_slots(expr);
+        }
+
+        declare_slots(stmt->_stmts);
+
+    }
+
+}
+
+/******************************************************************************/
+
+void Compiler_T::declare_slots(node_idx __idx) {
+
+    if (__idx == NO_NODE) {
+        return;
+    }
+
+    const ParseNode& node = (*_arena)[__idx];
+
+    // A symbol being assigned to is a variable of the chunk.
+    if (node._oper == OPER_ASSIGN && (*_arena)[node._left]._operand == OPERAND_SYMBOL) {
+        const std::string& name = _tokens.text((*_arena)[node._left]._token);
+        if (_slots.find(name) == _slots.end()) {
+            _slots[name] = add_slot(name);
+        }
+    }
+
+    declare_slots(node._left);
+    declare_slots(node._right);
+    declare_slots(node._target);
+
+    for (size_t arg = 0; arg < node._nargs; arg++) {
+        declare_slots(_arena->arg(node, arg));
+    }
+
+}
+
+/******************************************************************************/
+
+size_t Compiler_T::add_slot(const std::string& __name) {
+
+    size_t slot = _chunk->_num_slots++;
+    _chunk->_slot_map[get_symbol(__name)].push_back(slot);
+
+    return slot;
+
+}
+
+/******************************************************************************/
+
+bool Compiler_T::resolve_slot(const std::string& __name, size_t& __slot) const noexcept {
+
+    // The innermost loop variable of the name shadows the rest.
+    for (auto it = _iter_slots.rbegin(); it != _iter_slots.rend(); it++) {
+        if (it->first == __name) {
+            __slot = it->second;
+            return true;
+        }
+    }
+
+    auto it = _slots.find(__name);
+    if (it == _slots.end()) {
+        return false;
+    }
+
+    __slot = it->second;
+    return true;
+
+}
+
+/******************************************************************************/
+
+size_t Compiler_T::get_symbol(const std::string& __name) {
+
+    auto it = _symbols.find(__name);
+    if (it != _symbols.end()) {
+        return it->second;
+    }
+
+    size_t id = _symbols.size();
+    _symbols[__name] = id;
+    return id;
+
+}
+
+/******************************************************************************/
@@ -34,20 +34,6 @@ bool FunctionTable_T::is_function(const std::string& __func) const noexcept {
 
 /******************************************************************************/
 
-FunctionTable_T::obj_pair FunctionTable_T::call_function(const std::string& __func,
-                                                         const std::vector<obj>& __func_args,
-                                                         size_t __colnum, size_t __linenum) {
-
-    // Check if the provided function name is in the table.
-    if (!is_function(__func)) { return {nullptr, nullptr}; }
-    
-    // Call the appropriate function with the given args.
-    return _native_table[__func](__func_args, __colnum, __linenum);
-
-}
-
-/******************************************************************************/
-
 bool FunctionTable_T::is_member_function(const std::string& __func) const noexcept {
 
     return _native_member_table.count(__func) > 0;
@@ -56,32 +42,12 @@ bool FunctionTable_T::is_member_function(const std::string& __func) const noexce
 
 /******************************************************************************/
 
-FunctionTable_T::obj_pair FunctionTable_T::call_member_function
-    (const std::string& __func,
-     obj_pair& __obj,
-     const std::vector<obj>& __func_args,
-     size_t __colnum, size_t __linenum) {
-
-    // Check if the provided function name is in the member table.
-    if (!is_member_function(__func)) { return {nullptr, nullptr}; }
-    
-    // Call the appropriate function with the given args.
-    return _native_member_table[__func](__obj, __func_args, __colnum, __linenum);
-
-}
-
-/******************************************************************************/
-
 void FunctionTable_T::add_user_function(const std::string& __func,
                                         const std::vector<std::string>& __func_params,
-                                        size_t __scope, size_t __start_idx ,size_t __end_idx) noexcept {
+                                        size_t __scope, const std::shared_ptr<Chunk_T>& __chunk) noexcept {
 
-    // Create a shared_ptr to the new entry.
-    std::shared_ptr<UserFunction_T> new_func =
-        std::make_shared<UserFunction_T>(__func, __func_params, __scope, __start_idx, __end_idx);
-
-    // Push the function in the front of the user table, so it is found first.
-    _user_func_table.push_front(new_func);
+    _user_func_table[__func] =
+        std::make_shared<UserFunction_T>(__func, __func_params, __scope, __chunk);
 
 }
 
@@ -89,53 +55,58 @@ void FunctionTable_T::add_user_function(const std::string& __func,
 
 bool FunctionTable_T::is_user_function(const std::string& __func) const noexcept {
 
-    // Iterate through the user function table.
-    for (auto& func : _user_func_table) {
-
-        if (func->_func_name == __func) {
-            return true;
-        }
-
-    }
-
-    return false;
+    return _user_func_table.count(__func) > 0;
 
 }
 
 /******************************************************************************/
 
-std::shared_ptr<UserFunction_T> FunctionTable_T::get_user_function(const std::string& __func) const noexcept {
+FunctionTable_T::Callee_T FunctionTable_T::resolve(size_t __symbol, const std::string& __func) noexcept {
 
-    // Iterate through the function table.
-    for (auto& func : _user_func_table) {
+    if (__symbol >= _callees.size()) {
+        _callees.resize(__symbol + 1, {nullptr, nullptr});
+    }
+
+    Callee_T& callee = _callees[__symbol];
+
+    // Search the tables if the symbol has not resolved yet. A user
+    // function cannot share the name of a native one.
+    if (callee._native == nullptr && callee._user == nullptr) {
 
-        if (func->_func_name == __func) {
-            return func;
+        auto native = _native_table.find(__func);
+        if (native != _native_table.end()) {
+            callee._native = native->second;
+        } else {
+            auto user = _user_func_table.find(__func);
+            if (user != _user_func_table.end()) {
+                callee._user = user->second.get();
+            }
         }
 
     }
 
-    return nullptr;
+    return callee;
 
 }
 
 /******************************************************************************/
 
-void FunctionTable_T::release_above_scope(size_t __scope) noexcept {
+FunctionTable_T::native_member_func FunctionTable_T::resolve_member(size_t __symbol, const std::string& __func) noexcept {
 
-    std::deque<size_t> deletion;
+    if (__symbol >= _member_callees.size()) {
+        _member_callees.resize(__symbol + 1, nullptr);
+    }
+
+    native_member_func& callee = _member_callees[__symbol];
 
-    size_t idx = 0;
-    for (auto& func : _user_func_table) {
-        if (func->_scope >= __scope) {
-            deletion.push_front(idx);
+    if (callee == nullptr) {
+        auto native = _native_member_table.find(__func);
+        if (native != _native_member_table.end()) {
+            callee = native->second;
         }
-        idx++;
     }
 
-    for (auto it = deletion.begin(); it != deletion.end(); it++) {
-        _user_func_table.erase(_user_func_table.begin() + *it);
-    }
+    return callee;
 
 }
 
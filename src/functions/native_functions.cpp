@@ -14,6 +14,8 @@
 //  Inherited Subprograms:      None
 //
 //  Exported Subprograms:       out
+//                              outln
+//                              flush
 //                              
 /******************************************************************************/
 
@@ -21,8 +23,8 @@
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    out_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    out_func(const std::vector<RoskyValue>& __func_args,
         size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -32,17 +34,17 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
     }
 
     // Print the arg to stdout.
-    std::cout << __func_args.front()->to_string() << std::flush;
+    write_output(__func_args.front().to_string());
 
     // Return a null object.
-    return {nullptr, std::make_shared<RoskyNull>()};
+    return {nullptr, RoskyValue::make_null()};
 
 }
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    outln_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    outln_func(const std::vector<RoskyValue>& __func_args,
         size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -52,17 +54,37 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
     }
 
     // Print the arg to stdout with a new line.
-    std::cout << __func_args.front()->to_string() << std::endl;
+    write_output(__func_args.front().to_string() + '\n');
 
     // Return a null object.
-    return {nullptr, std::make_shared<RoskyNull>()};
+    return {nullptr, RoskyValue::make_null()};
 
 }
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    scan_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    flush_func(const std::vector<RoskyValue>& __func_args,
+        size_t __colnum, size_t __linenum) {
+
+    // Check the number of arguments.
+    if (__func_args.size() != 0) {
+        throw_error(ERR_BAD_FUNC_ARGS, "'flush' expects 0 arguments, received " +
+                    std::to_string(__func_args.size()), __colnum, __linenum);
+    }
+
+    // Write out the buffered output.
+    flush_output();
+
+    // Return a null object.
+    return {nullptr, RoskyValue::make_null()};
+
+}
+
+/******************************************************************************/
+
+std::pair<RoskyValue*, RoskyValue>
+    scan_func(const std::vector<RoskyValue>& __func_args,
         size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -76,25 +98,26 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
 
     // Overwrite the default if supplied an arg.
     if (__func_args.size() == 1) {
-        arg = __func_args.front()->to_string();
+        arg = __func_args.front().to_string();
     }
 
-    // Print the arg to stdout.
-    std::cout << arg;
+    // Print the arg to stdout, and write it out before prompting.
+    write_output(arg);
+    flush_output();
 
     // Prompt for stdin.
     std::string input_string;
     std::getline(std::cin, input_string);
 
     // Return a string object.
-    return {nullptr, std::make_shared<RoskyString>(input_string)};
+    return {nullptr, RoskyValue::make_string(input_string)};
 
 }
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    assert_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    assert_func(const std::vector<RoskyValue>& __func_args,
         size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -104,9 +127,9 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
     }
 
     // First argument must be a boolean.
-    if (__func_args.front()->get_type_id() != OBJ_BOOL) {
+    if (__func_args.front().get_type_id() != OBJ_BOOL) {
         throw_error(ERR_BAD_FUNC_ARGS, "'assert' expects argument of type 'bool', received '" +
-                    __func_args.front()->get_type_string() + "'",
+                    __func_args.front().get_type_string() + "'",
                     __colnum, __linenum);
     }
 
@@ -114,23 +137,23 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
 
     // Get the second argument.
     if (__func_args.size() == 2) {
-        err_message = __func_args.back()->to_string();
+        err_message = __func_args.back().to_string();
     }
 
     // If the argument is false, throw an assertion error.
-    if (__func_args.front()->to_bool() == false) {
+    if (__func_args.front().to_bool() == false) {
         throw_error(ERR_ASSERT, err_message, __colnum, __linenum);
     }
 
     // Return a null object.
-    return {nullptr, std::make_shared<RoskyNull>()};
+    return {nullptr, RoskyValue::make_null()};
 
 }
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    range_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    range_func(const std::vector<RoskyValue>& __func_args,
                 size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -141,9 +164,9 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
 
     // All of the arguments must be integers.
     for (size_t i = 0; i < __func_args.size(); i++) {
-        if (__func_args[i]->get_type_id() != OBJ_INT) {
+        if (__func_args[i].get_type_id() != OBJ_INT) {
             throw_error(ERR_BAD_FUNC_ARGS, "'range' expects argument of type 'int', received'" +
-                        __func_args[i]->get_type_string() + "'",
+                        __func_args[i].get_type_string() + "'",
                         __colnum, __linenum);
         }
     }
@@ -155,12 +178,12 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
 
     // Fill values based on args provided.
     if (__func_args.size() == 1) {
-        end = __func_args.front()->to_int();
+        end = __func_args.front().to_int();
     } else {
-        start = __func_args.front()->to_int();
-        end = __func_args[1]->to_int();
+        start = __func_args.front().to_int();
+        end = __func_args[1].to_int();
         if (__func_args.size() == 3) {
-            step = __func_args.back()->to_int();
+            step = __func_args.back().to_int();
         }
     }
 
@@ -169,26 +192,15 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         throw_error(ERR_INVALID_FUNC_USE, "'range' cannot have 'step' < 1", __colnum, __linenum);
     }
  
-    // Create a deque to hold the values.
-    std::deque<std::shared_ptr<RoskyInterface>> d;
-
-    // Iterate through the values and form the deque.
-    for (long i = start; i < end; i += step) {
-
-        //std::shared_ptr<RoskyInterface> int_obj = std::make_shared<RoskyInt>(i);
-        d.push_back(std::make_shared<RoskyInt>(i));
-
-    }
-
-    // Return the new object.
-    return {nullptr, std::make_shared<RoskyGroup>(d)};
+    // Return the new object. Its values are computed as they are used.
+    return {nullptr, make_object<RoskyRange>(start, end, step)};
 
 }
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    type_func(const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    type_func(const std::vector<RoskyValue>& __func_args,
                 size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -198,7 +210,7 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
     }
 
     // Return the stringof the type.
-    return {nullptr, std::make_shared<RoskyString>(__func_args.front()->get_type_string())};
+    return {nullptr, RoskyValue::make_string(__func_args.front().get_type_string())};
 
 }
 
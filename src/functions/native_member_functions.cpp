@@ -22,9 +22,9 @@
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    size_func(std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>& __obj,
-               const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    size_func(std::pair<RoskyValue*, RoskyValue>& __obj,
+               const std::vector<RoskyValue>& __func_args,
                size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -34,21 +34,21 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
     }
 
     // Ensure we have a string type as an object.
-    if (__obj.second->is_iterable() == false) {
+    if (__obj.second.is_iterable() == false) {
         throw_error(ERR_NONMEMBER, "'size' is not a member function for type '" +
-                    __obj.second->get_type_string() + "'", __colnum, __linenum);
+                    __obj.second.get_type_string() + "'", __colnum, __linenum);
     }
 
     // return the new obj.
-    return {nullptr, std::make_shared<RoskyInt>(__obj.second->get_size())};
+    return {nullptr, RoskyValue::make_int(__obj.second.get_size())};
 
 }
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    append_func(std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>& __obj,
-               const std::vector<std::shared_ptr<RoskyInterface>>& __func_args,
+std::pair<RoskyValue*, RoskyValue>
+    append_func(std::pair<RoskyValue*, RoskyValue>& __obj,
+               const std::vector<RoskyValue>& __func_args,
                size_t __colnum, size_t __linenum) {
 
     // Check the number of arguments.
@@ -58,20 +58,20 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
     }
 
     // Check if the object is a group.
-    if (__obj.second->get_type_id() != OBJ_GROUP) {
+    if (__obj.second.get_type_id() != OBJ_GROUP) {
         throw_error(ERR_NONMEMBER, "'append' is not a member function for type '" +
-                    __obj.second->get_type_string() + "'", __colnum, __linenum);
+                    __obj.second.get_type_string() + "'", __colnum, __linenum);
     }
 
     // Perform the function.
     if (__obj.first != nullptr) {
-        (*__obj.first)->append_func(__func_args.front());
+        __obj.first->append_func(__func_args.front());
     } else {
-        __obj.second->append_func(__func_args.front());
+        __obj.second.append_func(__func_args.front());
     }
 
     // Return null, since this is a void function.
-    return {nullptr, std::make_shared<RoskyNull>()};
+    return {nullptr, RoskyValue::make_null()};
 
 }
 
@@ -5,21 +5,27 @@
 //
 //  Description:                This file is responsible for "tokenizing"
 //                              a provided source file. Tokens are store
-//                              in a table (std::deque) with each entry
+//                              in a table (TokenTable_T) with each entry
 //                              containing certain metadata.
 //
+//                              Either line ending is accepted, as a
+//                              carriage return ending a line is skipped.
+//
+//                              Runs of whitespace, comments, identifiers
+//                              and string contents are scanned 16 bytes
+//                              at a time where SSE2 is available.
+//
 //                              Specific lexer errors such as unrecognized
 //                              or unexpected tokens can be caught and thrown
 //                              here, but the lexer is not responsible for
 //                              making logical or syntactic sense of the
 //                              source.
 //
-//                              After the table is created, it will be
-//                              fed into the parser.
+//                              After the table is created, it is returned
+//                              to be fed into the parser.
 //
 //  Dependencies:               source_handler.hpp
 //                              error_handler.hpp
-//                              parser.hpp
 //                              lexer_utils.hpp
 //
 //  Classes:                    None
@@ -32,158 +38,209 @@
 
 #include "../includes/lexer.hpp"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>              // _mm_loadu_si128, _mm_cmpeq_epi8...
+#endif
+
 // ***DEBUG***
 #include <iostream>
 // ***DEBUG***
 
 /******************************************************************************/
 
-void tokenize_src(std::unique_ptr<Src_T>& __src) {
+// The scanning functions below return the index of the first byte at or
+// after __idx that ends the run they scan, or __size if the run reaches
+// the end of the source.
 
-    // Create a deque to hold the token table.
-    std::deque<std::shared_ptr<Token_T>> tokens;
+#if defined(__SSE2__)
 
-    // Temporary string to hold each token.
-    std::string token;
-
-    // Index to iterate through input.
-    size_t idx = 0;
-
-    // This keeps track of the line number and column
-    // number in the source.
-    size_t colnum = 1;
-    size_t linenum = 1;
+// This function returns a mask of the bytes of a block in the range
+// [__lo, __hi]. Only ASCII ranges are compared.
+static inline __m128i in_range(__m128i __block, char __lo, char __hi) noexcept {
+    return _mm_and_si128(_mm_cmpgt_epi8(__block, _mm_set1_epi8(__lo - 1)),
+                         _mm_cmplt_epi8(__block, _mm_set1_epi8(__hi + 1)));
+}
 
-    // Flag to indicate if we are in a comment block.
-    bool in_comment = false;
+// This function returns the index of the first set bit of a block mask
+// offset by the block's index.
+static inline size_t first_of(size_t __idx, int __mask) noexcept {
+    return __idx + __builtin_ctz((unsigned)__mask);
+}
 
-    // Iterate through input src.
-    while (idx < __src->_data.size()) {
+#endif
 
-        // If in comment, ignore until new line.
-        if (in_comment) {
-            colnum++;
-            if (__src->_data[idx] == NEWLINE) {
-                linenum++;
-                colnum = 1;
-                in_comment = false;
-            }
-            idx++;
-            continue;
-        }
+// This function scans the run of spaces and tabs on a line.
+static size_t scan_spaces(const char* __data, size_t __idx, size_t __size) noexcept {
 
-        // Comment character '#'
-        if (__src->_data[idx] == COMMENT) {
-            in_comment = true;
-            colnum++;
-            idx++;
-            continue;
+#if defined(__SSE2__)
+    for (; __idx + 16 <= __size; __idx += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__data + __idx));
+        __m128i space = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(SPACE)),
+                                     in_range(block, HORIZTAB, VERTTAB));
+        space = _mm_andnot_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(NEWLINE)), space);
+        int mask = ~_mm_movemask_epi8(space) & 0xFFFF;
+        if (mask != 0) {
+            return first_of(__idx, mask);
         }
+    }
+#endif
 
-        // Ignore whitespace.
-        if (is_whitespace(__src->_data[idx])) {
-            colnum++;
-            if (__src->_data[idx] == NEWLINE) {
-                linenum++;
-                colnum = 1;
-            }
-            idx++;
-            continue;
-        }
+    while (__idx < __size && __data[__idx] != NEWLINE && is_whitespace(__data[__idx])) {
+        __idx++;
+    }
+    return __idx;
 
-        // Delimiters.
-        if (is_delimiter(__src->_data[idx])) {
-            token += __src->_data[idx];
+}
 
-            // Add the delimiter to the token table.
-            tokens.push_back(std::make_shared<Token_T>
-                (token, TOKEN_DELIM, colnum, linenum));
+// This function scans the rest of a line, up to its newline.
+static size_t scan_line(const char* __data, size_t __idx, size_t __size) noexcept {
 
-            // Reset the token and continue.
-            token = "";
-            idx++;
-            colnum++;
-            continue;
+#if defined(__SSE2__)
+    for (; __idx + 16 <= __size; __idx += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__data + __idx));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(NEWLINE)));
+        if (mask != 0) {
+            return first_of(__idx, mask);
         }
+    }
+#endif
 
-        // Operator
-        if (is_op(__src->_data[idx])) {
+    while (__idx < __size && __data[__idx] != NEWLINE) {
+        __idx++;
+    }
+    return __idx;
 
-            // Add the operator to the current token.
-            token += __src->_data[idx];
+}
 
-            // Bookmark the start column number.
-            size_t start_col = colnum;
+// This function scans the alphanumeric characters of an identifier.
+static size_t scan_ident(const char* __data, size_t __idx, size_t __size) noexcept {
+
+#if defined(__SSE2__)
+    for (; __idx + 16 <= __size; __idx += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__data + __idx));
+        __m128i alnum = _mm_or_si128(_mm_or_si128(in_range(block, 'a', 'z'), in_range(block, 'A', 'Z')),
+                                     _mm_or_si128(in_range(block, '0', '9'),
+                                                  _mm_cmpeq_epi8(block, _mm_set1_epi8('_'))));
+        int mask = ~_mm_movemask_epi8(alnum) & 0xFFFF;
+        if (mask != 0) {
+            return first_of(__idx, mask);
+        }
+    }
+#endif
 
-            if (idx + 1 < __src->_data.size()) {
+    while (__idx < __size && is_alphanum(__data[__idx])) {
+        __idx++;
+    }
+    return __idx;
 
-                if (token == "=" || token == "!" || token == "<" || token == ">") {
+}
 
-                    if (__src->_data[idx + 1] == '=') {
-                        idx++;
-                        colnum++;
-                        token += __src->_data[idx];
-                    }
+// This function scans the plain characters of a string literal, up to
+// its closing quote, an escape, or a line ending.
+static size_t scan_string(const char* __data, size_t __idx, size_t __size) noexcept {
+
+#if defined(__SSE2__)
+    for (; __idx + 16 <= __size; __idx += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__data + __idx));
+        __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')),
+                                                 _mm_cmpeq_epi8(block, _mm_set1_epi8(ESCCHAR))),
+                                    _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(NEWLINE)),
+                                                 _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'))));
+        int mask = _mm_movemask_epi8(stop);
+        if (mask != 0) {
+            return first_of(__idx, mask);
+        }
+    }
+#endif
 
-                    // Swap operator <->
-                    if (token == "<" && __src->_data[idx+1] == '-') {
+    while (__idx < __size) {
+        char c = __data[__idx];
+        if (c == '"' || c == char(ESCCHAR) || c == NEWLINE || c == '\r') {
+            break;
+        }
+        __idx++;
+    }
+    return __idx;
 
-                        if (idx + 2 < __src->_data.size() && __src->_data[idx+2] == '>') {
+}
 
-                            idx += 2;
-                            colnum += 2;
-                            token += "->";
+/******************************************************************************/
 
-                        }
+TokenTable_T tokenize_src(std::unique_ptr<Src_T>& __src) {
 
-                    }
+    // Create the token table.
+    TokenTable_T tokens;
 
-                } else if (token == "/") {
+    // The source's bytes. Tokens are sliced out of these directly.
+    const char* data = __src->_data;
+    size_t size = __src->_size;
 
-                    if (__src->_data[idx + 1] == '/') {
-                        idx++;
-                        colnum++;
-                        token += __src->_data[idx];
-                    }
+    // Temporary string to hold string literals.
+    std::string token;
 
-                }
+    // Index to iterate through input.
+    size_t idx = 0;
 
-            }
+    // This keeps track of the line number and column
+    // number in the source.
+    size_t colnum = 1;
+    size_t linenum = 1;
 
-            // Push the token into the table.
-            tokens.push_back(std::make_shared<Token_T>
-                (token, TOKEN_OP, start_col, linenum));
+    // Iterate through input src.
+    while (idx < size) {
 
-            // Reset the token and continue.
-            token = "";
+        // Skip a carriage return ending a line, which does not count
+        // towards the column.
+        if (data[idx] == '\r' && (idx + 1 == size || data[idx + 1] == NEWLINE)) {
             idx++;
-            colnum++;
             continue;
+        }
 
+        // Comment character '#'. Skip to the new line, which resets
+        // the column.
+        if (data[idx] == COMMENT) {
+            idx = scan_line(data, idx + 1, size);
+            continue;
         }
 
-        // Control Structures
-        if (is_ctrl_struct(__src->_data[idx])) {
+        // New line.
+        if (data[idx] == NEWLINE) {
+            linenum++;
+            colnum = 1;
+            idx++;
+            continue;
+        }
+
+        // Ignore whitespace.
+        if (is_whitespace(data[idx])) {
+            size_t end_idx = scan_spaces(data, idx, size);
+            colnum += end_idx - idx;
+            idx = end_idx;
+            continue;
+        }
 
-            // Add the operator to the current token.
-            token += __src->_data[idx];
+        // Operators, delimiters and control structures. The longest
+        // symbol starting here is taken.
+        size_t fixed_tok = 0;
+        size_t fixed_len = match_symbol(data + idx, size - idx, fixed_tok);
+        if (fixed_len != 0) {
 
             // Push the token into the table.
-            tokens.push_back(std::make_shared<Token_T>
-                (token, TOKEN_CTRL, colnum, linenum));
+            tokens.push(data + idx, fixed_len, fixed_tokens[fixed_tok]._kind,
+                        fixed_tokens[fixed_tok]._type, colnum, linenum);
 
-            // Reset the token and continue.
-            token = "";
-            idx++;
-            colnum++;
+            // Continue past the symbol.
+            idx += fixed_len;
+            colnum += fixed_len;
             continue;
 
         }
 
         // Number
-        if (is_num(__src->_data[idx])) {
+        if (is_num(data[idx])) {
 
-            // Bookmark the start column number of the token.
+            // Bookmark the start of the token.
+            size_t start_idx = idx;
             size_t start_col = colnum;
 
             // This flag holds whether the number is an integer
@@ -191,72 +248,66 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
             bool is_int = true;
 
             // Collect all numbers in sequence (including '.')
-            while (is_num(__src->_data[idx]) ||
-                   (__src->_data[idx] == '.')) {
+            while (idx < size && (is_num(data[idx]) || data[idx] == '.')) {
 
                 // If we collect a '.', set the flag.
                 // If the flag is already set, throw an error.
-                if (__src->_data[idx] == '.') {
+                if (data[idx] == '.') {
                     
                     if (is_int == false) {
-                        token += '.';
-                        throw_error(ERR_UNEXP_TOKEN, token, colnum, linenum);
+                        throw_error(ERR_UNEXP_TOKEN, std::string(data + start_idx, idx + 1 - start_idx),
+                                    colnum, linenum);
                     }
                     is_int = false;
 
                 }
 
-                token += __src->_data[idx++];
+                idx++;
                 colnum++;
             }
 
             // If the last character in the token is a decimal,
             // throw an error.
-            if (token[token.size()-1] == '.') {
-                throw_error(ERR_UNEXP_TOKEN, token, colnum, linenum);
+            if (data[idx - 1] == '.') {
+                throw_error(ERR_UNEXP_TOKEN, std::string(data + start_idx, idx - start_idx), colnum, linenum);
             }
 
-            // Determine the token type based on the flag.
-            TOKEN_TYPE t = is_int ? TOKEN_LIT_INT : TOKEN_LIT_FLOAT;
-
-            // Push the token into the table.
-            tokens.push_back(std::make_shared<Token_T>
-                             (token, t, start_col, linenum));
+            // Push the token into the table, typed based on the flag.
+            if (is_int) {
+                tokens.push(data + start_idx, idx - start_idx, KIND_INT, TOKEN_LIT_INT, start_col, linenum);
+            } else {
+                tokens.push(data + start_idx, idx - start_idx, KIND_FLOAT, TOKEN_LIT_FLOAT, start_col, linenum);
+            }
 
-            // Reset the token and continue.
-            token = "";
             continue;
 
         }
 
         // Alphanumeric
-        if (is_alpha(__src->_data[idx])) {
+        if (is_alpha(data[idx])) {
 
-            // Bookmark the start column number of the token.
+            // Bookmark the start of the token.
+            size_t start_idx = idx;
             size_t start_col = colnum;
 
             // Collect all the alphanumeric characters in sequence.
-            while (is_alphanum(__src->_data[idx])) {
-                token += __src->_data[idx++];
-                colnum++;
-            }
+            idx = scan_ident(data, idx, size);
+            colnum += idx - start_idx;
 
-            // Determine a token type based on if the token
+            // Determine a token kind and type based on if the token
             // is a keyword.
-            TOKEN_TYPE t = is_keyword(token) ? TOKEN_KW : TOKEN_SYMBOL;
+            TOKEN_KIND k = get_keyword(data + start_idx, idx - start_idx);
+            TOKEN_TYPE t = k == KIND_SYMBOL ? TOKEN_SYMBOL : TOKEN_KW;
 
             // Push the token into the table.
-            tokens.push_back(std::make_shared<Token_T>
-                             (token, t, start_col, linenum));
+            tokens.push(data + start_idx, idx - start_idx, k, t, start_col, linenum);
 
-            // Reset the token and continue.
-            token = "";
             continue;
 
         }
 
         // Quote
-        if (__src->_data[idx] == '"') {
+        if (data[idx] == '"') {
 
             // Bookmark the start column and line number.
             size_t start_col = colnum;
@@ -271,10 +322,20 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
 
             // Collect until receive close quote or until we
             // reach EOF.
-            while (idx < __src->_data.size()) {
+            while (idx < size) {
+
+                // Collect the plain characters in one go.
+                size_t run_idx = scan_string(data, idx, size);
+                token.append(data + idx, run_idx - idx);
+                colnum += run_idx - idx;
+                idx = run_idx;
+
+                if (idx == size) {
+                    break;
+                }
                 
                 // Check if end quote.
-                if (__src->_data[idx] == '"') {
+                if (data[idx] == '"') {
 
                     // Mark the flag.
                     found_end_quote = true;
@@ -285,24 +346,29 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
                 }
 
                 // Check escape character.
-                if (__src->_data[idx] == char(ESCCHAR)) {
+                if (data[idx] == char(ESCCHAR)) {
 
                     idx++;
                     colnum++;
 
+                    // An escape at EOF leaves the quote unclosed.
+                    if (idx == size) {
+                        break;
+                    }
+
                     // Check valid escape sequences.
-                    if (__src->_data[idx] == 'n') {
+                    if (data[idx] == 'n') {
                         token += char(NEWLINE);
-                    } else if (__src->_data[idx] == 't') {
+                    } else if (data[idx] == 't') {
                         token += char(HORIZTAB);
-                    } else if (__src->_data[idx] == char(ESCCHAR)) {
+                    } else if (data[idx] == char(ESCCHAR)) {
                         token += char(ESCCHAR);
-                    } else if (__src->_data[idx] == '0') {
+                    } else if (data[idx] == '0') {
                         token += char(0);
-                    } else if (__src->_data[idx] == '"') {
+                    } else if (data[idx] == '"') {
                         token += '"';
                     } else {
-                        token = __src->_data[idx];
+                        token = data[idx];
                         throw_error(ERR_INVALID_ESC_CHAR, token, colnum, linenum);
                     }
 
@@ -312,8 +378,14 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
 
                 }
 
+                // Skip a carriage return ending a line.
+                if (data[idx] == '\r' && (idx + 1 == size || data[idx + 1] == NEWLINE)) {
+                    idx++;
+                    continue;
+                }
+
                 // Check if new line.
-                if (__src->_data[idx] == NEWLINE) {
+                if (data[idx] == NEWLINE) {
 
                     // Increment the linenum and break.
                     linenum++;
@@ -322,7 +394,7 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
                 }
 
                 // Collect the char.
-                token += __src->_data[idx];
+                token += data[idx];
                 idx++;
                 colnum++;
 
@@ -335,8 +407,7 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
             }
 
             // Add the token as a string literal.
-            tokens.push_back(std::make_shared<Token_T>
-                            (token, TOKEN_LIT_STRING, start_col, start_lin));
+            tokens.push(token, KIND_STRING, TOKEN_LIT_STRING, start_col, start_lin);
 
             // Reset the token and continue.
             idx++;
@@ -347,7 +418,7 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
         }
 
         // Anything else is considered unexpected.
-        token += __src->_data[idx];
+        token += data[idx];
 
         // Throw error (exiting program).
         throw_error(ERR_UNEXP_TOKEN, token, colnum, linenum);
@@ -356,8 +427,8 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
 
     // ***DEBUG***
     // std::cout << "TOKEN:\t| TYPE:\t| LINE:\t| COL:" << std::endl;
-    // for (auto& tok : tokens) {
-    //     std::cout << tok->_token << "\t| " << TOKEN_STRINGS[tok->_type] << "\t| " << tok->_linenum << "\t| " << tok->_colnum << std::endl;
+    // for (size_t i = 0; i < tokens.size(); i++) {
+    //     std::cout << tokens.text(i) << "\t| " << TOKEN_STRINGS[tokens[i]._type] << "\t| " << tokens[i]._linenum << "\t| " << tokens[i]._colnum << std::endl;
     // }
     // ***DEBUG***
 
@@ -365,14 +436,8 @@ void tokenize_src(std::unique_ptr<Src_T>& __src) {
     // source to save memory.
     __src->clean();
 
-    // Instantiate the parser object.
-    Parser_T main_parser(tokens);
-
-    // Send the token table to the parser.
-    // Start index -> 0
-    // end index -> tokens.size()
-    // scope -> 0
-    main_parser.parse(0, tokens.size(), 0);
+    // Return the token table.
+    return tokens;
 
 }
 
@@ -6,7 +6,8 @@
 //  Description:                This file contains the class definition for
 //                              the built in boolean type.
 // 
-//                              The underlying data type is a bool
+//                              The underlying data type is a bool. It is
+//                              stored inline in a RoskyValue.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -66,75 +67,75 @@ bool RoskyBool::to_bool() const noexcept {
 /******************************************************************************/
 
 // String operators
-std::shared_ptr<RoskyInterface> RoskyBool::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyBool::concat_op(const RoskyValue& __r) const noexcept {
 
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+    return RoskyValue::make_string(to_string() + __r.to_string());
 
 }
 
 /******************************************************************************/
 
 // Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyBool::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyBool::eq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_BOOL) {
-        return std::make_shared<RoskyBool>(_data == __r->to_bool());
-    } else if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(false);
+    if (__r.get_type_id() == OBJ_BOOL) {
+        return RoskyValue::make_bool(_data == __r.to_bool());
+    } else if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(false);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 } 
 
-std::shared_ptr<RoskyInterface> RoskyBool::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyBool::neq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_BOOL) {
-        return std::make_shared<RoskyBool>(_data != __r->to_bool());
-    } else if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(true);
+    if (__r.get_type_id() == OBJ_BOOL) {
+        return RoskyValue::make_bool(_data != __r.to_bool());
+    } else if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(true);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 } 
 
 /******************************************************************************/
 
 // Boolean operators.
-std::shared_ptr<RoskyInterface> RoskyBool::not_op() const noexcept {
+RoskyValue RoskyBool::not_op() const noexcept {
 
-    return std::make_shared<RoskyBool>(!_data);
+    return RoskyValue::make_bool(!_data);
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyBool::and_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyBool::and_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_BOOL) {
-        return std::make_shared<RoskyBool>(_data && __r->to_bool());
+    if (__r.get_type_id() == OBJ_BOOL) {
+        return RoskyValue::make_bool(_data && __r.to_bool());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyBool::xor_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyBool::xor_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_BOOL) {
-        return std::make_shared<RoskyBool>((_data || __r->to_bool()) && !(_data && __r->to_bool()));
+    if (__r.get_type_id() == OBJ_BOOL) {
+        return RoskyValue::make_bool((_data || __r.to_bool()) && !(_data && __r.to_bool()));
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyBool::or_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyBool::or_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_BOOL) {
-        return std::make_shared<RoskyBool>(_data || __r->to_bool());
+    if (__r.get_type_id() == OBJ_BOOL) {
+        return RoskyValue::make_bool(_data || __r.to_bool());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
@@ -7,7 +7,9 @@
 //                              the built in float type.
 // 
 //                              The underlying data type is a double, rather
-//                              than a float.
+//                              than a float. Floats are stored inline
+//                              in a RoskyValue, which only constructs a
+//                              RoskyFloat to apply an operator.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -83,119 +85,119 @@ bool RoskyFloat::to_bool() const noexcept {
 /******************************************************************************/
 
 // Arithmetic operators.
-std::shared_ptr<RoskyInterface> RoskyFloat::add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::add_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(_data + __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(_data + __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::sub_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::sub_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(_data - __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(_data - __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::mul_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(_data * __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(_data * __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::div_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::div_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(_data / __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(_data / __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
 /******************************************************************************/
 
 // String operators.
-std::shared_ptr<RoskyInterface> RoskyFloat::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::concat_op(const RoskyValue& __r) const noexcept {
 
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+    return RoskyValue::make_string(to_string() + __r.to_string());
 
 }
 
 /******************************************************************************/
 
 // Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyFloat::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::eq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(_data == __r->to_float());
-    } else if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(false);
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(_data == __r.to_float());
+    } else if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(false);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::neq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(_data != __r->to_float());
-    } else if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(true);
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(_data != __r.to_float());
+    } else if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(true);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::gt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::gt_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(_data > __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(_data > __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::lt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::lt_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(_data < __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(_data < __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::geq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::geq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(_data >= __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(_data >= __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyFloat::leq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyFloat::leq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(_data <= __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(_data <= __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
@@ -6,7 +6,10 @@
 //  Description:                This file contains the class definition for
 //                              the built in group type.
 // 
-//                              The underlying data type is a deque.
+//                              The underlying data type is a deque, held
+//                              in a storage block that groups with the
+//                              same elements share. A shared block is
+//                              copied before it is written to.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -21,6 +24,8 @@
 //
 //  Exported Subprograms:       ctor
 //                              ctor(deque)
+//                              ctor(block)
+//                              share_block
 //                              
 /******************************************************************************/
 
@@ -28,6 +33,29 @@
 
 /******************************************************************************/
 
+// Storage.
+std::deque<RoskyValue>& RoskyGroup::write_data() noexcept {
+
+    if (_block.is_shared()) {
+        _block = RoskyRef(new RoskyGroupData(std::deque<RoskyValue>(data())));
+    }
+
+    return static_cast<RoskyGroupData*>(_block.get())->_elems;
+
+}
+
+RoskyRef RoskyGroup::share_block() const {
+
+    if (_pinned) {
+        return RoskyRef(new RoskyGroupData(std::deque<RoskyValue>(data())));
+    }
+
+    return _block;
+
+}
+
+/******************************************************************************/
+
 // Type information.
 OBJ_TYPES RoskyGroup::get_type_id() const noexcept {
     return OBJ_GROUP;
@@ -50,23 +78,27 @@ bool RoskyGroup::is_addressable() const noexcept {
 
 /******************************************************************************/
 
-// Casting.
+// Casting. The operators below read both groups through their size and
+// elements, so a range is not stored to be read.
 long RoskyGroup::to_int() const noexcept {
     return 0;
 }
 
 std::string RoskyGroup::to_string() const noexcept {
 
+    size_t size = get_size();
+
     std::string ret = "[";
-    for (auto it = _data.begin(); it != _data.end(); it++) {
+    for (size_t pos = 0; pos < size; pos++) {
 
-        if ((*it)->get_type_id() == OBJ_STRING) {
-            ret += ('"' + (*it)->to_string() + '"'); 
+        RoskyValue elem = element_at(pos);
+        if (elem.get_type_id() == OBJ_STRING) {
+            ret += ('"' + elem.to_string() + '"'); 
         } else {
-            ret += (*it)->to_string();
+            ret += elem.to_string();
         }
 
-        if (it + 1 != _data.end()) {
+        if (pos + 1 != size) {
             ret += ", ";
         }
 
@@ -78,116 +110,130 @@ std::string RoskyGroup::to_string() const noexcept {
 }
 
 bool RoskyGroup::to_bool() const noexcept {
-    return _data.size() != 0;
+    return get_size() != 0;
 }
 
-std::deque<std::shared_ptr<RoskyInterface>> RoskyGroup::to_group() const noexcept {
-    return _data;
+std::deque<RoskyValue> RoskyGroup::to_group() const noexcept {
+    return data();
 }
 
 /******************************************************************************/
 
-// Arithmetic operators.
-std::shared_ptr<RoskyInterface> RoskyGroup::add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+// Arithmetic operators. A result with the elements of one operand shares
+// its block.
+RoskyValue RoskyGroup::add_op(const RoskyValue& __r) const noexcept {
 
     // Only able to add other groups.
-    if (__r->get_type_id() == OBJ_GROUP) {
-        auto d = _data;
-        for (auto& data : __r->to_group()) {
-            d.push_back(data);
+    if (__r.get_type_id() == OBJ_GROUP) {
+
+        const RoskyGroup* r = static_cast<const RoskyGroup*>(__r.get_box());
+
+        if (r->get_size() == 0) {
+            return make_object<RoskyGroup>(share_block());
+        }
+        if (get_size() == 0) {
+            return make_object<RoskyGroup>(r->share_block());
+        }
+
+        std::deque<RoskyValue> d;
+        for (size_t pos = 0; pos < get_size(); pos++) {
+            d.push_back(element_at(pos));
+        }
+        for (size_t pos = 0; pos < r->get_size(); pos++) {
+            d.push_back(r->element_at(pos));
         }
-        return std::make_shared<RoskyGroup>(d);
+        return make_object<RoskyGroup>(std::move(d));
+
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyGroup::mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyGroup::mul_op(const RoskyValue& __r) const noexcept {
 
     // Can only be multiplied by integers.
-    if (__r->get_type_id() == OBJ_INT) {
-        std::deque<std::shared_ptr<RoskyInterface>> d;
-        for (long i = 0; i < __r->to_int(); i++) {
+    if (__r.get_type_id() == OBJ_INT) {
+
+        if (__r.to_int() == 1) {
+            return make_object<RoskyGroup>(share_block());
+        }
+
+        std::deque<RoskyValue> d;
+        for (long i = 0; i < __r.to_int(); i++) {
             
-            for (auto& data : _data) {
-                d.push_back(data);
+            for (size_t pos = 0; pos < get_size(); pos++) {
+                d.push_back(element_at(pos));
             }
 
         }
-        return std::make_shared<RoskyGroup>(d);
+        return make_object<RoskyGroup>(std::move(d));
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
 /******************************************************************************/
 
 // String operators.
-std::shared_ptr<RoskyInterface> RoskyGroup::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+RoskyValue RoskyGroup::concat_op(const RoskyValue& __r) const noexcept {
+    return RoskyValue::make_string(to_string() + __r.to_string());
 }
 
 /******************************************************************************/
 
-#include <iostream>
-// Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyGroup::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+// This function determines if every element of two groups of the same
+// size is equal. An incompatible comparison of elements is unequal.
+static bool elements_equal(const RoskyInterface& __l, const RoskyInterface& __r) noexcept {
 
-    // Can only be compared to other groups.
-    if (__r->get_type_id() == OBJ_GROUP) {
-        
-        if (_data.size() != __r->get_size()) {
-            return std::make_shared<RoskyBool>(false);
+    for (size_t pos = 0; pos < __l.get_size(); pos++) {
+
+        RoskyValue res = __l.element_at(pos).eq_op(__r.element_at(pos));
+        if (res.is_empty() || res.to_bool() == false) {
+            return false;
         }
 
-        for (size_t group_idx = 0; group_idx < _data.size(); group_idx++) {
+    }
 
-            std::shared_ptr<RoskyInterface> res = _data[group_idx]->eq_op(__r->to_group()[group_idx]);
-            if (res == nullptr) {
-                return std::make_shared<RoskyBool>(false);
-            }
-            if (res->to_bool() == false) {
-                return std::make_shared<RoskyBool>(false);
-            }
+    return true;
+
+}
 
+// Comparison operators.
+RoskyValue RoskyGroup::eq_op(const RoskyValue& __r) const noexcept {
+
+    // Can only be compared to other groups.
+    if (__r.get_type_id() == OBJ_GROUP) {
+
+        const RoskyInterface* r = __r.get_box();
+        if (get_size() != r->get_size()) {
+            return RoskyValue::make_bool(false);
         }
 
-        return std::make_shared<RoskyBool>(true);
+        return RoskyValue::make_bool(elements_equal(*this, *r));
 
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyGroup::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyGroup::neq_op(const RoskyValue& __r) const noexcept {
 
     // Can only be compared to other groups.
-    if (__r->get_type_id() == OBJ_GROUP) {
-        
-        if (_data.size() != __r->get_size()) {
-            return std::make_shared<RoskyBool>(false);
-        }
-
-        for (size_t group_idx = 0; group_idx < _data.size(); group_idx++) {
-
-            std::shared_ptr<RoskyInterface> res = _data[group_idx]->eq_op(__r->to_group()[group_idx]);
-            if (res == nullptr) {
-                return std::make_shared<RoskyBool>(true);
-            }
-            if (res->to_bool() == false) {
-                return std::make_shared<RoskyBool>(true);
-            }
+    if (__r.get_type_id() == OBJ_GROUP) {
 
+        const RoskyInterface* r = __r.get_box();
+        if (get_size() != r->get_size()) {
+            return RoskyValue::make_bool(false);
         }
 
-        return std::make_shared<RoskyBool>(false);
+        return RoskyValue::make_bool(!elements_equal(*this, *r));
 
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
@@ -195,28 +241,49 @@ std::shared_ptr<RoskyInterface> RoskyGroup::neq_op(const std::shared_ptr<RoskyIn
 
 // Iterable functionality.
 size_t RoskyGroup::get_size() const noexcept {
-    return _data.size();
+    return data().size();
 }
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    RoskyGroup::index_op(const std::shared_ptr<RoskyInterface>& __r) noexcept {
+RoskyValue RoskyGroup::element_at(size_t __pos) const noexcept {
+    return data()[__pos];
+}
 
-    if (__r->get_type_id() != OBJ_INT) {
-        return {nullptr, nullptr};
+std::pair<RoskyValue*, RoskyValue>
+    RoskyGroup::index_op(const RoskyValue& __r) noexcept {
+
+    if (__r.get_type_id() != OBJ_INT) {
+        return {nullptr, RoskyValue()};
     }
 
-    if (__r->to_int() < _data.size() && __r->to_int() >= 0) {
-        return { &(_data[__r->to_int()]), _data[__r->to_int()] };
+    if (__r.to_int() < data().size() && __r.to_int() >= 0) {
+
+        // The element's address is handed out, so the block is pinned.
+        auto& d = write_data();
+        _pinned = true;
+        return { &(d[__r.to_int()]), d[__r.to_int()] };
+
     }
 
-    return {nullptr, nullptr};
+    return {nullptr, RoskyValue()};
 
 }
 
-void RoskyGroup::append_func(const std::shared_ptr<RoskyInterface>& __r) noexcept {
+void RoskyGroup::append_func(const RoskyValue& __r) noexcept {
 
-    _data.push_back(__r);
+    write_data().push_back(__r);
+
+}
+
+/******************************************************************************/
+
+// Iteration. The size is checked on every step, so elements appended
+// during the iteration are reached.
+bool RoskyGroup::done(size_t __pos) const noexcept {
+    return __pos >= data().size();
+}
 
+RoskyValue RoskyGroup::next(size_t& __pos) const noexcept {
+    return data()[__pos++];
 }
 
 /******************************************************************************/
@@ -7,7 +7,9 @@
 //                              the built in integer type.
 // 
 //                              The underlying data type is a long, rather
-//                              than an int.
+//                              than an int. Integers are stored inline
+//                              in a RoskyValue, which only constructs a
+//                              RoskyInt to apply an operator.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -71,161 +73,161 @@ bool RoskyInt::to_bool() const noexcept {
 /******************************************************************************/
 
 // Arithmetic operators.
-std::shared_ptr<RoskyInterface> RoskyInt::add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::add_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyInt>(_data + __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(to_float() + __r->to_float());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_int(_data + __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(to_float() + __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::sub_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::sub_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyInt>(_data - __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(to_float() - __r->to_float());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_int(_data - __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(to_float() - __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::mul_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyInt>(_data * __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(to_float() * __r->to_float());
-    } else if (__r->get_type_id() == OBJ_STRING) {
-        return __r->mul_op(std::make_shared<RoskyInt>(_data));
-    } else if (__r->get_type_id() == OBJ_GROUP) {
-        return __r->mul_op(std::make_shared<RoskyInt>(_data));
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_int(_data * __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(to_float() * __r.to_float());
+    } else if (__r.get_type_id() == OBJ_STRING) {
+        return __r.mul_op(RoskyValue::make_int(_data));
+    } else if (__r.get_type_id() == OBJ_GROUP) {
+        return __r.mul_op(RoskyValue::make_int(_data));
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::div_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::div_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT || __r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyFloat>(to_float() / __r->to_float());
+    if (__r.get_type_id() == OBJ_INT || __r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_float(to_float() / __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::idiv_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::idiv_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyInt>((long)(_data / __r->to_int()));
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_int((long)(_data / __r.to_int()));
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::mod_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::mod_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyInt>(_data % __r->to_int());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_int(_data % __r.to_int());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
 /******************************************************************************/
 
 // String operators.
-std::shared_ptr<RoskyInterface> RoskyInt::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::concat_op(const RoskyValue& __r) const noexcept {
 
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+    return RoskyValue::make_string(to_string() + __r.to_string());
 
 }
 
 /******************************************************************************/
 
 // Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyInt::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
-
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyBool>(_data == __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(to_float() == __r->to_float());
-    } else if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(false);
+RoskyValue RoskyInt::eq_op(const RoskyValue& __r) const noexcept {
+
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_bool(_data == __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(to_float() == __r.to_float());
+    } else if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(false);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::neq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyBool>(_data != __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(to_float() != __r->to_float());
-    } else if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(true);
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_bool(_data != __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(to_float() != __r.to_float());
+    } else if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(true);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::gt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::gt_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyBool>(_data > __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(to_float() > __r->to_float());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_bool(_data > __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(to_float() > __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::lt_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::lt_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyBool>(_data < __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(to_float() < __r->to_float());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_bool(_data < __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(to_float() < __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::geq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::geq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyBool>(_data >= __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(to_float() >= __r->to_float());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_bool(_data >= __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(to_float() >= __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyInt::leq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyInt::leq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_INT) {
-        return std::make_shared<RoskyBool>(_data <= __r->to_int());
-    } else if (__r->get_type_id() == OBJ_FLOAT) {
-        return std::make_shared<RoskyBool>(to_float() <= __r->to_float());
+    if (__r.get_type_id() == OBJ_INT) {
+        return RoskyValue::make_bool(_data <= __r.to_int());
+    } else if (__r.get_type_id() == OBJ_FLOAT) {
+        return RoskyValue::make_bool(to_float() <= __r.to_float());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
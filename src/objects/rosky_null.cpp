@@ -7,7 +7,8 @@
 //                              the built in null type.
 // 
 //                              There is no underlying data type for this
-//                              class.
+//                              class. Null values are stored inline in
+//                              a RoskyValue.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -64,32 +65,32 @@ bool RoskyNull::to_bool() const noexcept {
 /******************************************************************************/
 
 // String operators.
-std::shared_ptr<RoskyInterface> RoskyNull::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyNull::concat_op(const RoskyValue& __r) const noexcept {
 
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+    return RoskyValue::make_string(to_string() + __r.to_string());
 
 }
 
 /******************************************************************************/
 
 // Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyNull::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyNull::eq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(true);
+    if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(true);
     }
 
-    return std::make_shared<RoskyBool>(false);
+    return RoskyValue::make_bool(false);
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyNull::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyNull::neq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(false);
+    if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(false);
     }
 
-    return std::make_shared<RoskyBool>(true);
+    return RoskyValue::make_bool(true);
 
 }
 
@@ -7,7 +7,8 @@
 //                              the built in pointer type.
 // 
 //                              The underlying data type is a pointer
-//                              to a shared_ptr instance of an object.
+//                              to the value of a variable or group
+//                              element.
 //
 //  Dependencies:               RoskyInterface
 //
@@ -69,7 +70,7 @@ std::string RoskyPointer::to_string() const noexcept {
     return ss.str();
 }
 
-std::shared_ptr<RoskyInterface>* RoskyPointer::to_pointer() const noexcept {
+RoskyValue* RoskyPointer::to_pointer() const noexcept {
     return _data;
 }
 
@@ -80,10 +81,10 @@ bool RoskyPointer::to_bool() const noexcept {
 /******************************************************************************/
 
 // Pointer operators.
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> RoskyPointer::deref_op() const noexcept {
+std::pair<RoskyValue*, RoskyValue> RoskyPointer::deref_op() const noexcept {
 
     if (_data == nullptr) {
-        return {nullptr, nullptr};
+        return {nullptr, RoskyValue()};
     }
 
     return {_data, *_data};
@@ -93,38 +94,38 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> Ros
 /******************************************************************************/
 
 // String operators.
-std::shared_ptr<RoskyInterface> RoskyPointer::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyPointer::concat_op(const RoskyValue& __r) const noexcept {
 
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+    return RoskyValue::make_string(to_string() + __r.to_string());
 
 }
 
 /******************************************************************************/
 
 // Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyPointer::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyPointer::eq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_POINTER) {
-        return std::make_shared<RoskyBool>(_data == __r->to_pointer());
+    if (__r.get_type_id() == OBJ_POINTER) {
+        return RoskyValue::make_bool(_data == __r.to_pointer());
     }
-    if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(false);
+    if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(false);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyPointer::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyPointer::neq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_POINTER) {
-        return std::make_shared<RoskyBool>(_data != __r->to_pointer());
+    if (__r.get_type_id() == OBJ_POINTER) {
+        return RoskyValue::make_bool(_data != __r.to_pointer());
     }
-    if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(true);
+    if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(true);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
@@ -0,0 +1,126 @@
+
+/******************************************************************************/
+//
+//  Source Name:                rosky_range.cpp
+//
+//  Description:                This file contains the class definition for
+//                              the group returned by the range function.
+//
+//                              Its elements are computed from the start,
+//                              step and size on demand. The group is only
+//                              stored once an element is addressed or
+//                              appended, after which it behaves as a
+//                              regular group.
+//
+//  Dependencies:               RoskyGroup
+//
+//  Classes:                    RoskyRange
+//
+//  Inherited Subprograms:      get_type_id
+//                              get_type_string
+//                              is_iterable
+//                              is_addressable
+//                              to_int
+//                              to_string
+//                              to_bool
+//                              add_op
+//                              mul_op
+//                              concat_op
+//                              eq_op
+//                              neq_op
+//
+//  Exported Subprograms:       ctor(start, end, step)
+//
+/******************************************************************************/
+
+#include "../../includes/objects/rosky_range.hpp"
+
+/******************************************************************************/
+
+void RoskyRange::store() noexcept {
+
+    if (_stored) {
+        return;
+    }
+
+    write_data() = to_group();
+    _stored = true;
+
+}
+
+/******************************************************************************/
+
+// Casting. The operators of the group are formed from the size and
+// elements, so they act on the range without storing it.
+std::deque<RoskyValue> RoskyRange::to_group() const noexcept {
+
+    if (_stored) {
+        return data();
+    }
+
+    std::deque<RoskyValue> d;
+    for (size_t pos = 0; !done(pos);) {
+        d.push_back(next(pos));
+    }
+
+    return d;
+
+}
+
+/******************************************************************************/
+
+// Sharing.
+RoskyRef RoskyRange::share_block() const {
+
+    if (_stored) {
+        return RoskyGroup::share_block();
+    }
+
+    return RoskyRef(new RoskyGroupData(to_group()));
+
+}
+
+/******************************************************************************/
+
+// Iterable functionality.
+size_t RoskyRange::get_size() const noexcept {
+    return _stored ? data().size() : _size;
+}
+
+RoskyValue RoskyRange::element_at(size_t __pos) const noexcept {
+
+    if (_stored) {
+        return data()[__pos];
+    }
+
+    return RoskyValue::make_int(_start + (long)__pos * _step);
+
+}
+
+std::pair<RoskyValue*, RoskyValue> RoskyRange::index_op(const RoskyValue& __r) noexcept {
+
+    // The element's address is returned, so it must be stored.
+    store();
+    return RoskyGroup::index_op(__r);
+
+}
+
+void RoskyRange::append_func(const RoskyValue& __r) noexcept {
+
+    store();
+    RoskyGroup::append_func(__r);
+
+}
+
+/******************************************************************************/
+
+// Iteration. The elements are computed unless the group is stored.
+bool RoskyRange::done(size_t __pos) const noexcept {
+    return __pos >= get_size();
+}
+
+RoskyValue RoskyRange::next(size_t& __pos) const noexcept {
+    return element_at(__pos++);
+}
+
+/******************************************************************************/
@@ -66,67 +66,67 @@ bool RoskyString::to_bool() const noexcept {
 /******************************************************************************/
 
 // Arithmetic operators.
-std::shared_ptr<RoskyInterface> RoskyString::add_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyString::add_op(const RoskyValue& __r) const noexcept {
 
     // Strings can only be added with other strings.
-    if (__r->get_type_id() == OBJ_STRING) {
-        return std::make_shared<RoskyString>(_data + __r->to_string());
+    if (__r.get_type_id() == OBJ_STRING) {
+        return RoskyValue::make_string(_data + __r.to_string());
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyString::mul_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyString::mul_op(const RoskyValue& __r) const noexcept {
 
     // Strings can only be multiplied by integers.
-    if (__r->get_type_id() == OBJ_INT) {
+    if (__r.get_type_id() == OBJ_INT) {
         std::string s = "";
-        for (long i = 0; i < __r->to_int(); i++) {
+        for (long i = 0; i < __r.to_int(); i++) {
             s += _data;
         }
-        return std::make_shared<RoskyString>(s);
+        return RoskyValue::make_string(std::move(s));
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
 /******************************************************************************/
 
 // String operators.
-std::shared_ptr<RoskyInterface> RoskyString::concat_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyString::concat_op(const RoskyValue& __r) const noexcept {
 
-    return std::make_shared<RoskyString>(to_string() + __r->to_string());
+    return RoskyValue::make_string(to_string() + __r.to_string());
 
 }
 
 /******************************************************************************/
 
 // Comparison operators.
-std::shared_ptr<RoskyInterface> RoskyString::eq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyString::eq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_STRING) {
-        return std::make_shared<RoskyBool>(_data == __r->to_string());
+    if (__r.get_type_id() == OBJ_STRING) {
+        return RoskyValue::make_bool(_data == __r.to_string());
     }
-    if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(false);
+    if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(false);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
-std::shared_ptr<RoskyInterface> RoskyString::neq_op(const std::shared_ptr<RoskyInterface>& __r) const noexcept {
+RoskyValue RoskyString::neq_op(const RoskyValue& __r) const noexcept {
 
-    if (__r->get_type_id() == OBJ_STRING) {
-        return std::make_shared<RoskyBool>(_data != __r->to_string());
+    if (__r.get_type_id() == OBJ_STRING) {
+        return RoskyValue::make_bool(_data != __r.to_string());
     }
-    if (__r->get_type_id() == OBJ_NULL) {
-        return std::make_shared<RoskyBool>(true);
+    if (__r.get_type_id() == OBJ_NULL) {
+        return RoskyValue::make_bool(true);
     }
 
-    return nullptr;
+    return RoskyValue();
 
 }
 
@@ -137,21 +137,32 @@ size_t RoskyString::get_size() const noexcept {
     return _data.size();
 }
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    RoskyString::index_op(const std::shared_ptr<RoskyInterface>& __r) noexcept {
+std::pair<RoskyValue*, RoskyValue>
+    RoskyString::index_op(const RoskyValue& __r) noexcept {
 
-    if (__r->get_type_id() != OBJ_INT) {
-        return {nullptr, nullptr};
+    if (__r.get_type_id() != OBJ_INT) {
+        return {nullptr, RoskyValue()};
     }
 
-    if (__r->to_int() < _data.size() && __r->to_int() >= 0) {
+    if (__r.to_int() < _data.size() && __r.to_int() >= 0) {
         std::string ret_val = "";
-        ret_val += _data[__r->to_int()];
-        return {nullptr, std::make_shared<RoskyString>(ret_val)};
+        ret_val += _data[__r.to_int()];
+        return {nullptr, RoskyValue::make_string(ret_val)};
     }
 
-    return {nullptr, nullptr};
+    return {nullptr, RoskyValue()};
 
 }
 
+/******************************************************************************/
+
+// Iteration. Each character is produced as a string.
+bool RoskyString::done(size_t __pos) const noexcept {
+    return __pos >= _data.size();
+}
+
+RoskyValue RoskyString::next(size_t& __pos) const noexcept {
+    return RoskyValue::make_string(std::string(1, _data[__pos++]));
+}
+
 /******************************************************************************/
\ No newline at end of file
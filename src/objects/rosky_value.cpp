@@ -0,0 +1,262 @@
+
+/******************************************************************************/
+//
+//  Source Name:                rosky_value.cpp
+//
+//  Description:                This file contains the class definition for
+//                              the value every variable, group element
+//                              and operand holds.
+//
+//                              Integers, floats, booleans and null are
+//                              stored inline in the value. Strings, groups
+//                              and pointers are boxed in a RoskyInterface
+//                              object that the value shares ownership of.
+//
+//                              A value can also be empty, which denotes an
+//                              unbound variable or an incompatible
+//                              operation.
+//
+//                              Boxed objects are never modified once
+//                              formed, except for groups. So nullptr,
+//                              the empty string and the single character
+//                              strings each have one shared box, formed
+//                              on first use.
+//
+//  Dependencies:               RoskyInterface
+//
+//  Classes:                    RoskyValue
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       ctor
+//                              ctor(obj)
+//                              make_int
+//                              make_float
+//                              make_bool
+//                              make_null
+//                              make_nullptr
+//                              make_string
+//                              is_empty
+//                              get_type_id
+//                              get_box
+//
+/******************************************************************************/
+
+#include "../../includes/objects/rosky_value.hpp"
+#include "../../includes/objects/rosky_interface.hpp"
+#include "../../includes/objects/rosky_int.hpp"
+#include "../../includes/objects/rosky_float.hpp"
+#include "../../includes/objects/rosky_bool.hpp"
+#include "../../includes/objects/rosky_null.hpp"
+#include "../../includes/objects/rosky_pointer.hpp"
+#include "../../includes/objects/rosky_string.hpp"
+
+/******************************************************************************/
+
+// An empty value behaves as null.
+template <typename F>
+auto RoskyValue::dispatch(F __f) const noexcept {
+
+    switch (_type) {
+
+        case OBJ_INT: {
+            RoskyInt obj(_int);
+            return __f(obj);
+        }
+        case OBJ_FLOAT: {
+            RoskyFloat obj(_float);
+            return __f(obj);
+        }
+        case OBJ_BOOL: {
+            RoskyBool obj(_bool);
+            return __f(obj);
+        }
+        case OBJ_NULL:
+        case OBJ_NONE: {
+            RoskyNull obj;
+            return __f(obj);
+        }
+        default:
+            return __f(*get_box());
+
+    }
+
+}
+
+/******************************************************************************/
+
+// Factories of the boxed immutable types.
+RoskyValue RoskyValue::make_nullptr() noexcept {
+
+    static const RoskyValue null_ptr(make_object<RoskyPointer>(nullptr));
+    return null_ptr;
+
+}
+
+RoskyValue RoskyValue::make_string(std::string __data) noexcept {
+
+    // The shared boxes of the empty string and of each single character
+    // string, indexed by size and character.
+    static RoskyValue small_strings[257];
+
+    if (__data.size() > 1) {
+        return RoskyValue(make_object<RoskyString>(std::move(__data)));
+    }
+
+    size_t idx = __data.empty() ? 0 : 1 + (unsigned char)__data[0];
+    if (small_strings[idx].is_empty()) {
+        small_strings[idx] = RoskyValue(make_object<RoskyString>(std::move(__data)));
+    }
+
+    return small_strings[idx];
+
+}
+
+/******************************************************************************/
+
+// Type information.
+std::string RoskyValue::get_type_string() const noexcept {
+    return dispatch([](auto& __o) { return __o.get_type_string(); });
+}
+
+/******************************************************************************/
+
+// Iterable information.
+bool RoskyValue::is_iterable() const noexcept {
+    return dispatch([](auto& __o) { return __o.is_iterable(); });
+}
+
+bool RoskyValue::is_addressable() const noexcept {
+    return dispatch([](auto& __o) { return __o.is_addressable(); });
+}
+
+/******************************************************************************/
+
+// Casting.
+long RoskyValue::to_int() const noexcept {
+    return dispatch([](auto& __o) { return __o.to_int(); });
+}
+
+double RoskyValue::to_float() const noexcept {
+    return dispatch([](auto& __o) { return __o.to_float(); });
+}
+
+std::string RoskyValue::to_string() const noexcept {
+    return dispatch([](auto& __o) { return __o.to_string(); });
+}
+
+RoskyValue* RoskyValue::to_pointer() const noexcept {
+    return dispatch([](auto& __o) { return __o.to_pointer(); });
+}
+
+bool RoskyValue::to_bool() const noexcept {
+    return dispatch([](auto& __o) { return __o.to_bool(); });
+}
+
+std::deque<RoskyValue> RoskyValue::to_group() const noexcept {
+    return dispatch([](auto& __o) { return __o.to_group(); });
+}
+
+/******************************************************************************/
+
+// Arithmetic operators.
+RoskyValue RoskyValue::add_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.add_op(__r); });
+}
+
+RoskyValue RoskyValue::sub_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.sub_op(__r); });
+}
+
+RoskyValue RoskyValue::mul_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.mul_op(__r); });
+}
+
+RoskyValue RoskyValue::div_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.div_op(__r); });
+}
+
+RoskyValue RoskyValue::idiv_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.idiv_op(__r); });
+}
+
+RoskyValue RoskyValue::mod_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.mod_op(__r); });
+}
+
+/******************************************************************************/
+
+// Pointer operators.
+std::pair<RoskyValue*, RoskyValue> RoskyValue::deref_op() const noexcept {
+    return dispatch([](auto& __o) { return __o.deref_op(); });
+}
+
+/******************************************************************************/
+
+// String operators.
+RoskyValue RoskyValue::concat_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.concat_op(__r); });
+}
+
+/******************************************************************************/
+
+// Comparison operators.
+RoskyValue RoskyValue::eq_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.eq_op(__r); });
+}
+
+RoskyValue RoskyValue::neq_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.neq_op(__r); });
+}
+
+RoskyValue RoskyValue::gt_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.gt_op(__r); });
+}
+
+RoskyValue RoskyValue::lt_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.lt_op(__r); });
+}
+
+RoskyValue RoskyValue::geq_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.geq_op(__r); });
+}
+
+RoskyValue RoskyValue::leq_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.leq_op(__r); });
+}
+
+/******************************************************************************/
+
+// Boolean operators.
+RoskyValue RoskyValue::not_op() const noexcept {
+    return dispatch([](auto& __o) { return __o.not_op(); });
+}
+
+RoskyValue RoskyValue::and_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.and_op(__r); });
+}
+
+RoskyValue RoskyValue::xor_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.xor_op(__r); });
+}
+
+RoskyValue RoskyValue::or_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.or_op(__r); });
+}
+
+/******************************************************************************/
+
+// Iterable functionality.
+size_t RoskyValue::get_size() const noexcept {
+    return dispatch([](auto& __o) { return __o.get_size(); });
+}
+
+std::pair<RoskyValue*, RoskyValue> RoskyValue::index_op(const RoskyValue& __r) const noexcept {
+    return dispatch([&](auto& __o) { return __o.index_op(__r); });
+}
+
+void RoskyValue::append_func(const RoskyValue& __r) const noexcept {
+    dispatch([&](auto& __o) { __o.append_func(__r); });
+}
+
+/******************************************************************************/
@@ -0,0 +1,89 @@
+/******************************************************************************/
+//
+//  Source Name:                output_handler.cpp
+//
+//  Description:                This file is responsible for buffering
+//                              the program's standard output, so that
+//                              printing does not cost a write per call.
+//
+//                              The buffer is written out when it fills,
+//                              at exit, before an error is reported, when
+//                              stdin is read, and on an explicit flush.
+//                              If stdout is a terminal, it is also written
+//                              out at the end of every line.
+//
+//  Dependencies:               None
+//
+//  Classes:                    None
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       write_output
+//                              flush_output
+//
+/******************************************************************************/
+
+#include <cstdio>                       // fwrite, fflush, fileno
+#include <cstdlib>                      // atexit
+#include <cstring>                      // memcpy
+#include <unistd.h>                     // isatty
+
+#include "../includes/output_handler.hpp"
+
+/******************************************************************************/
+
+// The buffered output, and the number of bytes it holds.
+static char output_buffer[OUTPUT_BUFFER_SIZE];
+static size_t output_size = 0;
+
+// Whether the buffer has been set up, and if it is written out at the
+// end of every line.
+static bool output_ready = false;
+static bool output_line_buffered = false;
+
+/******************************************************************************/
+
+void write_output(const std::string& __str) {
+
+    // On the first write, check if stdout is a terminal, and make sure
+    // the buffer is written out at exit.
+    if (!output_ready) {
+        output_line_buffered = isatty(fileno(stdout));
+        std::atexit(flush_output);
+        output_ready = true;
+    }
+
+    // Make room for the string, or write it directly if it could never
+    // fit.
+    if (output_size + __str.size() > OUTPUT_BUFFER_SIZE) {
+        flush_output();
+    }
+    if (__str.size() > OUTPUT_BUFFER_SIZE) {
+        fwrite(__str.data(), 1, __str.size(), stdout);
+        fflush(stdout);
+        return;
+    }
+
+    memcpy(output_buffer + output_size, __str.data(), __str.size());
+    output_size += __str.size();
+
+    if (output_line_buffered && __str.find('\n') != std::string::npos) {
+        flush_output();
+    }
+
+}
+
+/******************************************************************************/
+
+void flush_output() {
+
+    if (output_size > 0) {
+        fwrite(output_buffer, 1, output_size, stdout);
+        output_size = 0;
+    }
+
+    fflush(stdout);
+
+}
+
+/******************************************************************************/
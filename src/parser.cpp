@@ -10,15 +10,14 @@
 //                              parsing is handled in specific parse functions
 //                              pertaining to the tokens needing to be parsed.
 // 
-//                              The parser will catch logical as well as
-//                              syntactical errors.
+//                              The parser will catch syntactical errors
+//                              and forms the token table into a tree of
+//                              statement and expression nodes, which is
+//                              built once and handed to the executor.
 //
 //  Dependencies:               lexer_utils.hpp
 //                              parser_utils.hpp
 //                              error_handler.hpp
-//                              evaluator.hpp
-//                              variable_handler.hpp
-//                              rosky_interface.hpp
 //
 //  Classes:                    Parser_T
 //
@@ -33,7 +32,10 @@
 
 /******************************************************************************/
 
-void Parser_T::parse(size_t __start_idx, size_t __end_idx, size_t __scope) {
+std::vector<std::shared_ptr<StmtNode>> Parser_T::parse(size_t __start_idx, size_t __end_idx) {
+
+    // This holds the statements parsed from the range.
+    std::vector<std::shared_ptr<StmtNode>> stmts;
 
     // Create an index iterator. The reason this is
     // chosen over a traditional std::iterator is
@@ -48,155 +50,153 @@ void Parser_T::parse(size_t __start_idx, size_t __end_idx, size_t __scope) {
     // Iterate through the token table.
     for (; idx < __end_idx; idx++) {
 
-        // If any of these flags are asserted, return.
-        if (_cont_flag || _break_flag || _return_flag) {
-            return;
-        }
-
         // token is a literal.
-        if (is_literal(_tokens[idx]->_type)) {
+        if (is_literal(_tokens[idx]._type)) {
 
             // Parse as expression.
-            size_t end_idx = find_nextof(_tokens, idx, ";");
-            if (end_idx == 0 || end_idx > __end_idx) {
-                throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]->_colnum, _tokens[__end_idx - 1]->_linenum);
-            }
-            auto ignore = parse_expr(idx, end_idx, __scope);
+            stmts.push_back(parse_expr_stmt(idx, __end_idx));
             continue;
 
         }
 
         // Token is a keyword.
-        if (_tokens[idx]->_type == TOKEN_KW) {
+        if (_tokens[idx]._type == TOKEN_KW) {
 
             // Check keyword and parse accordingly.
-            if (_tokens[idx]->_token == "if") {
-                parse_if(idx, __end_idx, __scope + 1);
-                continue;
-            }
-            if (_tokens[idx]->_token == "while") {
-                parse_while(idx, __end_idx, __scope+1);
-                continue;
-            }
-            if (_tokens[idx]->_token == "for") {
-                parse_for(idx, __end_idx, __scope+1);
-                continue;
-            }
+            switch (_tokens[idx]._kind) {
+
+                case KIND_IF:
+                    stmts.push_back(parse_if(idx, __end_idx));
+                    continue;
+                case KIND_WHILE:
+                    stmts.push_back(parse_while(idx, __end_idx));
+                    continue;
+                case KIND_FOR:
+                    stmts.push_back(parse_for(idx, __end_idx));
+                    continue;
+
+                // Func keywords.
+                case KIND_FUNC:
+                    stmts.push_back(parse_func_def(idx, __end_idx));
+                    continue;
+                case KIND_RETURN:
+                    stmts.push_back(parse_return(idx, __end_idx));
+                    continue;
+
+                // Loop keywords.
+                case KIND_CONTINUE:
+                    stmts.push_back(parse_continue(idx, __end_idx));
+                    continue;
+                case KIND_BREAK:
+                    stmts.push_back(parse_break(idx, __end_idx));
+                    continue;
+
+                default:
+                    break;
 
-            // Func keywords.
-            if (_tokens[idx]->_token == "func") {
-                parse_func_def(idx, __end_idx, __scope);
-                continue;
-            }
-            if (_tokens[idx]->_token == "return") {
-                parse_return(idx, __end_idx, __scope);
-                return;
-            }
-
-            // Loop keywords.
-            if (_tokens[idx]->_token == "continue") {
-                parse_continue(idx, __end_idx, __scope);
-                // Return so the loop advances.
-                return;
-            }
-            if (_tokens[idx]->_token == "break") {
-                parse_break(idx, __end_idx, __scope);
-                return;
             }
 
             // Keyword will be parsed as expression.
-            size_t end_idx = find_nextof(_tokens, idx, ";");
-            if (end_idx == 0 || end_idx > __end_idx) {
-                throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]->_colnum, _tokens[__end_idx - 1]->_linenum);
-            }
-            auto ignore = parse_expr(idx, end_idx, __scope);
+            stmts.push_back(parse_expr_stmt(idx, __end_idx));
             continue;
 
         }
 
         // Token is a symbol.
-        if (_tokens[idx]->_type == TOKEN_SYMBOL) {
+        if (_tokens[idx]._type == TOKEN_SYMBOL) {
 
             // Token must be an expression.
-            size_t end_idx = find_nextof(_tokens, idx, ";");
-            if (end_idx == 0 || end_idx > __end_idx) {
-                throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]->_colnum, _tokens[__end_idx - 1]->_linenum);
-            }
-            auto ignore = parse_expr(idx, end_idx, __scope);
-
+            stmts.push_back(parse_expr_stmt(idx, __end_idx));
             continue;
 
         }
 
         // Token is an operator.
-        if (_tokens[idx]->_type == TOKEN_OP) {
+        if (_tokens[idx]._type == TOKEN_OP) {
 
             // Only select prefix ops can be considered starters
             // of an expression, otherwise this check fails.
-            if (is_expr_op(_tokens[idx]->_token)) {
-                size_t end_idx = find_nextof(_tokens, idx, ";");
-                if (end_idx == 0 || end_idx > __end_idx) {
-                    throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]->_colnum, _tokens[__end_idx - 1]->_linenum);
-                }
-                auto ignore = parse_expr(idx, end_idx, __scope);
+            if (is_expr_op(_tokens[idx]._kind)) {
+                stmts.push_back(parse_expr_stmt(idx, __end_idx));
                 continue;
             }
 
         }
 
         // Token is a control structure.
-        if (_tokens[idx]->_type == TOKEN_CTRL) {
+        if (_tokens[idx]._type == TOKEN_CTRL) {
 
             // If left paren, parse as expression.
-            if (_tokens[idx]->_token == "(") {
-                size_t end_idx = find_nextof(_tokens, idx, ";");
-                if (end_idx == 0 || end_idx > __end_idx) {
-                    throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]->_colnum, _tokens[__end_idx - 1]->_linenum);
-                }
-                auto ignore = parse_expr(idx, end_idx, __scope);
+            if (_tokens[idx]._kind == KIND_LPAREN) {
+                stmts.push_back(parse_expr_stmt(idx, __end_idx));
                 continue;
             }
 
             // Left curly brace.
-            if (_tokens[idx]->_token == "{") {
+            if (_tokens[idx]._kind == KIND_LBRACE) {
 
                 // Find the matching brace.
-                size_t match_idx = find_matching_ctrl(_tokens, idx, "{");
+                size_t match_idx = find_matching_ctrl(_index, idx);
 
                 // If the match is not found, throw an error.
                 if (match_idx == 0) {
-                    throw_error(ERR_UNCLOSED_BRACE, "", _tokens[idx]->_colnum, _tokens[idx]->_linenum);
+                    throw_error(ERR_UNCLOSED_BRACE, "", _tokens[idx]._colnum, _tokens[idx]._linenum);
                 }
 
-                // Increment the scope.
-                __scope++;
+                // Parse the block and skip over its closing brace.
+                stmts.push_back(parse_body(idx, match_idx));
+                idx = match_idx;
                 continue;
 
             }
 
-            // Right curly brace.
-            if (_tokens[idx]->_token == "}") {
-                
-                // If the scope is already zero, throw an error.
-                if (__scope == 0) {
-                    throw_error(ERR_SYNTAX, "}", _tokens[idx]->_colnum, _tokens[idx]->_linenum);
-                }
-
-                // Release variables off the table above scope.
-                _var_table->release_above_scope(__scope);
-
-                // Decrement the scope.
-                __scope--;
-                continue;
+            // Right curly brace. Blocks consume their own closing brace,
+            // so any brace reaching here is unmatched.
+            if (_tokens[idx]._kind == KIND_RBRACE) {
+                throw_error(ERR_SYNTAX, "}", _tokens[idx]._colnum, _tokens[idx]._linenum);
             }
 
         }
 
         // Anything reaching here is considered a syntax error.
-        throw_error(ERR_SYNTAX, _tokens[idx]->_token, _tokens[idx]->_colnum, _tokens[idx]->_linenum);
+        throw_error(ERR_SYNTAX, _tokens.text(idx), _tokens[idx]._colnum, _tokens[idx]._linenum);
+
+    }
+
+    return stmts;
+
+}
+
+/******************************************************************************/
+
+std::shared_ptr<StmtNode> Parser_T::parse_expr_stmt(size_t& __idx, size_t __end_idx) {
 
+    // Find the terminator of the expression.
+    size_t end_idx = find_nextof(_index, __idx, KIND_SEMI);
+    if (end_idx == 0 || end_idx > __end_idx) {
+        throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]._colnum, _tokens[__end_idx - 1]._linenum);
     }
 
+    // Create the statement and parse the expression into it.
+    auto stmt = std::make_shared<StmtNode>(STMT_EXPR, _tokens[__idx]._colnum, _tokens[__idx]._linenum);
+    stmt->_exprs.push_back(parse_expr(__idx, end_idx));
+
+    return stmt;
+
+}
+
+/******************************************************************************/
+
+std::shared_ptr<StmtNode> Parser_T::parse_body(size_t __open_idx, size_t __close_idx) {
+
+    // Create the block statement at the opening brace.
+    auto block = std::make_shared<StmtNode>(STMT_BLOCK, _tokens[__open_idx]._colnum, _tokens[__open_idx]._linenum);
+
+    // Parse everything between the braces.
+    block->_stmts = parse(__open_idx + 1, __close_idx);
+
+    return block;
+
 }
 
 /******************************************************************************/
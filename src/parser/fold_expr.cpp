@@ -0,0 +1,280 @@
+/******************************************************************************/
+//
+//  Source Name:                fold_expr.cpp
+//
+//  Description:                This file is responsible for simplifying
+//                              an expression tree once it is parsed.
+//
+//                              Operators whose operands are all constant
+//                              are evaluated with the same operator
+//                              methods the virtual machine uses, and the
+//                              node is replaced by the resulting constant.
+//                              An operator that would fail is left for the
+//                              virtual machine to report when it runs. An
+//                              and/or whose left side is a constant that
+//                              decides the result is folded too, as its
+//                              right side would be skipped.
+//
+//                              Operators that leave their other operand
+//                              unchanged (i.e. b and true) are dropped
+//                              when the other operand is known to be of
+//                              the type the identity holds for.
+//
+//  Dependencies:               parser_utils.hpp
+//
+//  Classes:                    Parser_T
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       fold_expr
+//
+/******************************************************************************/
+
+#include "../../includes/parser.hpp"
+
+/******************************************************************************/
+
+// This function applies an operator to constant operands. Returns an
+// empty value if the operator is not folded or is incompatible.
+static RoskyValue fold_oper(OPERATOR_TYPE __oper, const RoskyValue& __l, const RoskyValue& __r) {
+
+    switch (__oper) {
+        case OPER_ADD:      return __l.add_op(__r);
+        case OPER_SUB:      return __l.sub_op(__r);
+        case OPER_DIV:      return __l.div_op(__r);
+        case OPER_IDIV:     return __l.idiv_op(__r);
+        case OPER_MOD:      return __l.mod_op(__r);
+        case OPER_CONCAT:   return __l.concat_op(__r);
+        case OPER_EQ:       return __l.eq_op(__r);
+        case OPER_NEQ:      return __l.neq_op(__r);
+        case OPER_GT:       return __l.gt_op(__r);
+        case OPER_LT:       return __l.lt_op(__r);
+        case OPER_GEQ:      return __l.geq_op(__r);
+        case OPER_LEQ:      return __l.leq_op(__r);
+        case OPER_AND:      return __l.and_op(__r);
+        case OPER_OR:       return __l.or_op(__r);
+        case OPER_XOR:      return __l.xor_op(__r);
+        case OPER_NOT:      return __r.not_op();
+
+        // A repeated string may be far larger than its source, so it
+        // is only formed when it runs.
+        case OPER_MUL:
+            if (__l.get_type_id() == OBJ_STRING || __r.get_type_id() == OBJ_STRING) {
+                return RoskyValue();
+            }
+            return __l.mul_op(__r);
+
+        // Assignment, swap, index, deref and address need an object.
+        default:            return RoskyValue();
+    }
+
+}
+
+// This function determines if an operator leaves its other operand
+// unchanged when one operand is the given constant, provided the other
+// operand is of the returned type. Returns OBJ_NONE if it does not.
+static OBJ_TYPES get_identity_type(OPERATOR_TYPE __oper, const RoskyValue& __obj) {
+
+    OBJ_TYPES type = __obj.get_type_id();
+
+    switch (__oper) {
+
+        // b and true, b == true
+        case OPER_AND:
+        case OPER_EQ:
+            return (type == OBJ_BOOL && __obj.to_bool()) ? OBJ_BOOL : OBJ_NONE;
+
+        // b or false, b xor false, b != false
+        case OPER_OR:
+        case OPER_XOR:
+        case OPER_NEQ:
+            return (type == OBJ_BOOL && !__obj.to_bool()) ? OBJ_BOOL : OBJ_NONE;
+
+        // s & ""
+        case OPER_CONCAT:
+            return (type == OBJ_STRING && __obj.to_string().empty()) ? OBJ_STRING : OBJ_NONE;
+
+        default:
+            return OBJ_NONE;
+
+    }
+
+}
+
+/******************************************************************************/
+
+// This function returns the constant object of a constant node.
+RoskyValue Parser_T::get_const(node_idx __node) const {
+
+    const ParseNode& node = (*_arena)[__node];
+
+    if (node._operand == OPERAND_CONST) {
+        return _arena->_consts[node._args];
+    }
+
+    return form_object(_tokens[node._token]._kind, _tokens.text(node._token));
+
+}
+
+// This function returns the type a node is known to evaluate to before
+// it runs, or OBJ_NONE if it is not known.
+OBJ_TYPES Parser_T::get_static_type(node_idx __node) const {
+
+    const ParseNode& node = (*_arena)[__node];
+
+    switch (node._operand) {
+
+        case OPERAND_LITERAL:
+        case OPERAND_CONST:
+            return get_const(__node).get_type_id();
+
+        case OPERAND_EXPR:
+            return get_static_type(node._target);
+
+        default:
+            break;
+
+    }
+
+    // Comparisons and boolean operators always form a boolean, and
+    // concatenation always forms a string, if they succeed.
+    switch (node._oper) {
+        case OPER_EQ:
+        case OPER_NEQ:
+        case OPER_GT:
+        case OPER_LT:
+        case OPER_GEQ:
+        case OPER_LEQ:
+        case OPER_AND:
+        case OPER_OR:
+        case OPER_XOR:
+        case OPER_NOT:
+            return OBJ_BOOL;
+        case OPER_CONCAT:
+            return OBJ_STRING;
+        default:
+            return OBJ_NONE;
+    }
+
+}
+
+// This function replaces a node with a constant.
+void Parser_T::set_const(node_idx __node, const RoskyValue& __obj) {
+
+    _arena->_consts.push_back(__obj);
+
+    ParseNode& node = (*_arena)[__node];
+    node._type = PARSE_OPERAND;
+    node._operand = OPERAND_CONST;
+    node._oper = OPER_NONE;
+    node._args = (uint32_t)(_arena->_consts.size() - 1);
+    node._left = NO_NODE;
+    node._right = NO_NODE;
+
+}
+
+// This function replaces a node with one of its operands, by making it
+// a sub-expression of the operand.
+void Parser_T::replace_node(node_idx __node, node_idx __operand) {
+
+    ParseNode& node = (*_arena)[__node];
+
+    node._type = PARSE_OPERAND;
+    node._operand = OPERAND_EXPR;
+    node._oper = OPER_NONE;
+    node._target = __operand;
+    node._left = NO_NODE;
+    node._right = NO_NODE;
+
+    (*_arena)[__operand]._parent = __node;
+
+}
+
+/******************************************************************************/
+
+bool Parser_T::fold_expr(node_idx __node) {
+
+    ExprArena_T& arena = *_arena;
+
+    if (__node == NO_NODE) {
+        return false;
+    }
+
+    // Literals are constant. Sub-expressions are folded when they are
+    // parsed, so their root is never constant, and neither are symbols,
+    // calls or groups.
+    if (arena[__node]._type == PARSE_OPERAND) {
+        return arena[__node]._operand == OPERAND_LITERAL ||
+               arena[__node]._operand == OPERAND_CONST;
+    }
+
+    OPERATOR_TYPE oper = arena[__node]._oper;
+    node_idx left = arena[__node]._left;
+    node_idx right = arena[__node]._right;
+
+    // Fold the operands first. Unary operators only have a right side.
+    bool unary = is_unary_oper(oper);
+    bool left_const = !unary && fold_expr(left);
+    bool right_const = fold_expr(right);
+
+    // false and x, true or x, whose right side is never evaluated.
+    if (left_const && (oper == OPER_AND || oper == OPER_OR)) {
+
+        RoskyValue l = get_const(left);
+        if (l.get_type_id() == OBJ_BOOL && l.to_bool() == (oper == OPER_OR)) {
+            set_const(__node, l);
+            return true;
+        }
+
+    }
+
+    // Replace an operator on constants with its result. A literal that
+    // does not form an object (i.e. an integer out of range) is left for
+    // the compiler to report.
+    if ((left_const || unary) && right_const) {
+
+        RoskyValue l = unary ? RoskyValue::make_null() : get_const(left);
+        RoskyValue r = get_const(right);
+        if (l.is_empty() || r.is_empty()) {
+            return false;
+        }
+
+        RoskyValue obj = fold_oper(oper, l, r);
+        if (obj.is_empty()) {
+            return false;
+        }
+
+        set_const(__node, obj);
+        return true;
+
+    }
+
+    // not not b
+    if (oper == OPER_NOT && arena[right]._oper == OPER_NOT &&
+        get_static_type(arena[right]._right) == OBJ_BOOL) {
+        replace_node(__node, arena[right]._right);
+        return false;
+    }
+
+    // Drop an identity when the other operand's type is known.
+    if (left_const) {
+
+        OBJ_TYPES type = get_identity_type(oper, get_const(left));
+        if (type != OBJ_NONE && get_static_type(right) == type) {
+            replace_node(__node, right);
+        }
+
+    } else if (right_const) {
+
+        OBJ_TYPES type = get_identity_type(oper, get_const(right));
+        if (type != OBJ_NONE && get_static_type(left) == type) {
+            replace_node(__node, left);
+        }
+
+    }
+
+    return false;
+
+}
+
+/******************************************************************************/
@@ -10,15 +10,12 @@
 // 
 //                              Upon failure, an error will be thrown.
 // 
-//                              Upon success, it will call the evaluator
-//                              to evaluate the parse tree.
+//                              Upon success, the root of the parse tree
+//                              is returned for the executor to evaluate.
 //
 //  Dependencies:               lexer_utils.hpp
 //                              parser_utils.hpp
 //                              error_handler.hpp
-//                              evaluator.hpp
-//                              variable_handler.hpp
-//                              rosky_interface.hpp
 //
 //  Classes:                    Parser_T
 //
@@ -32,36 +29,34 @@
 
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    Parser_T::parse_expr(size_t& __idx, size_t __end_idx, size_t __scope) {
+node_idx Parser_T::parse_expr(size_t& __idx, size_t __end_idx) {
+
+    // The arena the tree is built in.
+    ExprArena_T& arena = *_arena;
 
     // This flag determines if we are expecting an operator or not.
     bool expecting_op = false;
 
     // This holds the root node of the final parse tree.
-    std::shared_ptr<ParseNode> root = nullptr;
-
-    // Capture the first token's linenum and colnum for potential error reporting.
-    size_t err_linenum = _tokens[__idx]->_linenum;
-    size_t err_colnum = _tokens[__idx]->_colnum;
+    node_idx root = NO_NODE;
 
     // Iterate through the token table.
     for (; __idx < __end_idx; __idx++) {
 
         // Literal token type.
-        if (is_literal(_tokens[__idx]->_type)) {
+        if (is_literal(_tokens[__idx]._type)) {
 
             // If we are expecting an op, throw an error (exits program).
             if (expecting_op) {
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
-            // Form the object.
-            auto obj_form = form_object(_tokens[__idx], _var_table, __scope, _recursive_index);
+            // Form the literal node.
+            node_idx node = arena.add(PARSE_OPERAND, OPERAND_LITERAL, __idx);
 
             // Continue down the right side of the tree until right child is null,
             // then insert self as right child.
-            insert_right(root, obj_form->_obj_adr, obj_form->_obj, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum, obj_form->_recursive_index);
+            insert_right(arena, root, node);
 
             // Now expecting an operator.
             expecting_op = true;
@@ -70,38 +65,27 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         }
 
         // Symbol.
-        if (_tokens[__idx]->_type == TOKEN_SYMBOL) {
+        if (_tokens[__idx]._type == TOKEN_SYMBOL) {
 
             // If we are expecting an op, throw an error.
             if (expecting_op) {
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
-            // Create a temporary for the object pair
-            std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>> obj_pair = {nullptr, nullptr};
-            size_t _r_index = 0;
-
             // If the next token is a left paren, pass as function, otherwise
             // pass as symbol.
-            if (_tokens[__idx+1]->_token == "(") {
+            if (_tokens[__idx+1]._kind == KIND_LPAREN) {
 
-                // Parse the function and get the result.
-                obj_pair = parse_func(__idx, __end_idx, __scope);
-                _r_index = _recursive_index;
+                // Parse the function call.
+                insert_right(arena, root, parse_func(__idx, __end_idx));
 
             } else {
                 
                 // symbol is treated as a variable name.
-                auto obj_form = form_object(_tokens[__idx], _var_table, __scope, _recursive_index);
-                obj_pair.first = obj_form->_obj_adr;
-                obj_pair.second = obj_form->_obj;
-                _r_index = obj_form->_recursive_index;
+                insert_right(arena, root, arena.add(PARSE_OPERAND, OPERAND_SYMBOL, __idx));
 
             }
 
-            // Insert the object pair right.
-            insert_right(root, obj_pair.first, obj_pair.second, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum, _r_index);
-
             // Now expecting an operator.
             expecting_op = true;
             continue;
@@ -109,16 +93,16 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         }
 
         // Keyword.
-        if (_tokens[__idx]->_type == TOKEN_KW) {
+        if (_tokens[__idx]._type == TOKEN_KW) {
 
             // If we are expecting an op, check for keyword operators.
             if (expecting_op) {
 
-                if (_tokens[__idx]->_token == "and" || _tokens[__idx]->_token == "or" ||
-                    _tokens[__idx]->_token == "xor") {
+                if (_tokens[__idx]._kind == KIND_AND || _tokens[__idx]._kind == KIND_OR ||
+                    _tokens[__idx]._kind == KIND_XOR) {
 
                     // Add the keywords as an operator.
-                    insert_op(root, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    insert_op(arena, root, get_operator(_tokens[__idx]._kind, false), __idx);
 
                     // Now not expecting an op.
                     expecting_op = false;
@@ -126,19 +110,16 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
 
                 }
 
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
-            // Form the object.
-            auto obj_form = form_object(_tokens[__idx], _var_table, __scope, _recursive_index);
-
-            // If the object is null, the keyword is an illegal use.
-            if (obj_form->_obj_adr == nullptr && obj_form->_obj == nullptr) {
-                throw_error(ERR_RESERVED_USE, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+            // If the keyword does not form an object, it is an illegal use.
+            if (form_object(_tokens[__idx]._kind, _tokens.text(__idx)).is_empty()) {
+                throw_error(ERR_RESERVED_USE, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
-            // Insert right.
-            insert_right(root, obj_form->_obj_adr, obj_form->_obj, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum, obj_form->_recursive_index);
+            // Insert right as a literal.
+            insert_right(arena, root, arena.add(PARSE_OPERAND, OPERAND_LITERAL, __idx));
 
             // Now expecting an operator.
             expecting_op = true;
@@ -147,36 +128,37 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         }
 
         // Parentheses.
-        if (_tokens[__idx]->_type == TOKEN_CTRL) {
+        if (_tokens[__idx]._type == TOKEN_CTRL) {
 
             // Left paren and not expecting op.
-            if (_tokens[__idx]->_token == "(" && !expecting_op) {
+            if (_tokens[__idx]._kind == KIND_LPAREN && !expecting_op) {
                 // Find matching paren.
-                size_t match_idx = find_matching_ctrl(_tokens, __idx, "(");
+                size_t match_idx = find_matching_ctrl(_index, __idx);
 
                 // If no matching paren, throw an error.
                 if (match_idx == 0) {
-                    throw_error(ERR_UNCLOSED_PAREN, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    throw_error(ERR_UNCLOSED_PAREN, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                 }
 
                 // If the matching paren is the next token, throw an error.
                 if (__idx + 1 == match_idx) {
-                    throw_error(ERR_EMPTY_PARENS, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    throw_error(ERR_EMPTY_PARENS, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                 }
 
                 // If the matching paren is at a higher index than our stop
                 // point, throw an error.
                 if (match_idx > __end_idx) {
-                    throw_error(ERR_TERM_BEFORE_CLOSURE, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    throw_error(ERR_TERM_BEFORE_CLOSURE, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                 }
 
+                // Bookmark the paren's token.
+                size_t paren_idx = __idx;
+
                 // Recursively call the parse_expr function with the new bounds.
-                auto obj_pair = parse_expr(++__idx, match_idx, __scope);
+                node_idx sub_root = parse_expr(++__idx, match_idx);
 
-                // Insert the result to the right.
-                // The token metadata doesn't matter because errors pertaining
-                // to evaluation of this object would have been caught already.
-                insert_right(root, obj_pair.first, obj_pair.second, "", 0, 0, _recursive_index);
+                // Insert the sub-expression to the right.
+                insert_right(arena, root, make_subexpr(arena, sub_root, paren_idx));
 
                 // Now expecting an operator.
                 expecting_op = true;
@@ -187,36 +169,33 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         }
 
         // Operator token type.
-        if (_tokens[__idx]->_type == TOKEN_OP) {
+        if (_tokens[__idx]._type == TOKEN_OP) {
 
-            // Hold the operator string.
-            std::string op_string = _tokens[__idx]->_token;
+            // Hold the operator kind.
+            TOKEN_KIND op_kind = _tokens[__idx]._kind;
 
             // If not expecting an operator.
             if (!expecting_op) {
 
                 // Special case for new group forming.
-                if (op_string == "[") {
+                if (op_kind == KIND_LBRACKET) {
 
                     // Find the matching bracket.
-                    size_t match_idx = find_matching_ctrl(_tokens, __idx, "[");
+                    size_t match_idx = find_matching_ctrl(_index, __idx);
 
                     // Check if not found.
                     if (match_idx == 0) {
-                        throw_error(ERR_UNCLOSED_BRACKET, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                        throw_error(ERR_UNCLOSED_BRACKET, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                     }
 
                     // If the matching paren is at a higher index than our stop
                     // point, throw an error.
                     if (match_idx > __end_idx) {
-                        throw_error(ERR_TERM_BEFORE_CLOSURE, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                        throw_error(ERR_TERM_BEFORE_CLOSURE, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                     }
 
-                    // Call the group parser.
-                    auto obj_pair = parse_group(__idx, match_idx, __scope);
-
-                    // Insert the group object.
-                    insert_right(root, obj_pair.first, obj_pair.second, "", 0, 0, _recursive_index);
+                    // Call the group parser and insert the group node.
+                    insert_right(arena, root, parse_group(__idx, match_idx));
 
                     // Now expecting op.
                     expecting_op = true;
@@ -225,50 +204,49 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
                 }
 
                 // If it's a unary operator, insert it.
-                if (is_unary_op(op_string)) {
+                if (is_unary_op(op_kind)) {
                     
-                    // Special case where the operator is '*', which in this
-                    // case is deref, set the op string to "de" to avoid
-                    // confusion.
-                    op_string = op_string == "*" ? "de" : op_string;
-
-                    // Insert the operator.
-                    insert_op(root, op_string, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    // Insert the operator. In this position '*' resolves
+                    // to deref rather than multiply.
+                    insert_op(arena, root, get_operator(op_kind, true), __idx);
 
                 } else {
 
                     // Not a unary op, throw an error.
-                    throw_error(ERR_SYNTAX, op_string, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
 
                 }
 
             } else { // expecting operator.
 
                 // Special case for index operator.
-                if (op_string == "[") {
+                if (op_kind == KIND_LBRACKET) {
 
                     // Find the matching bracket.
-                    size_t match_idx = find_matching_ctrl(_tokens, __idx, "[");
+                    size_t match_idx = find_matching_ctrl(_index, __idx);
 
                     // Check if not found.
                     if (match_idx == 0) {
-                        throw_error(ERR_UNCLOSED_BRACKET, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                        throw_error(ERR_UNCLOSED_BRACKET, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                     }
 
                     // If the matching paren is at a higher index than our stop
                     // point, throw an error.
                     if (match_idx > __end_idx) {
-                        throw_error(ERR_TERM_BEFORE_CLOSURE, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                        throw_error(ERR_TERM_BEFORE_CLOSURE, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                     }
 
                     // Push the operator into the tree.
-                    insert_op(root, "[", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    insert_op(arena, root, OPER_INDEX, __idx);
+
+                    // Bookmark the bracket's token.
+                    size_t bracket_idx = __idx;
 
-                    // Evaluate inside the brackets.
-                    auto obj_pair = parse_expr(++__idx, match_idx, __scope);
+                    // Parse inside the brackets.
+                    node_idx sub_root = parse_expr(++__idx, match_idx);
 
-                    // Push the result into the tree.
-                    insert_right(root, obj_pair.first, obj_pair.second, "", 0, 0, _recursive_index);
+                    // Push the index expression into the tree.
+                    insert_right(arena, root, make_subexpr(arena, sub_root, bracket_idx));
 
                     // Now expecting operator.
                     expecting_op = true;
@@ -277,16 +255,23 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
                 }
 
                 // If it's a unary operator, only allow "*" which is multiply.
-                if (is_unary_op(op_string)) {
+                if (is_unary_op(op_kind)) {
 
-                    if (op_string != "*") {
-                        throw_error(ERR_SYNTAX, op_string, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                    if (op_kind != KIND_STAR) {
+                        throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
                     }                    
 
                 }
 
+                // Resolve the operator. A stray closing bracket is not
+                // an operator.
+                OPERATOR_TYPE oper = get_operator(op_kind, false);
+                if (oper == OPER_NONE) {
+                    throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
+                }
+
                 // Insert the operator.
-                insert_op(root, op_string, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                insert_op(arena, root, oper, __idx);
 
             }
 
@@ -297,36 +282,31 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         }
 
         // Member functions.
-        if (_tokens[__idx]->_token == ".") {
+        if (_tokens[__idx]._kind == KIND_DOT) {
 
             // If not expecting op, throw error.
             if (!expecting_op) {
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
             // If we haven't inserted an object yet, throw syntax.
-            if (root == nullptr) {
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+            if (root == NO_NODE) {
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
             // Grab the last object inserted into the tree.
-            auto last_obj = get_last_obj(root);
-
-            // If the last object is null, throw unrecognized symbol.
-            if (last_obj->is_nullptr()) {
-                throw_error(ERR_UNREC_SYM, last_obj->_op, last_obj->_colnum, last_obj->_linenum);
-            }
+            node_idx last_obj = get_last_obj(arena, root);
 
             // If this is the last token, throw error.
             if (__idx + 1 == __end_idx) {
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
             // Parse the member function starting at the next index.
-            auto obj_pair = parse_member_func({last_obj->_obj_adr, last_obj->_obj}, ++__idx, __end_idx, __scope);
+            node_idx member_node = parse_member_func(last_obj, ++__idx, __end_idx);
 
-            // Insert the resulting object in place of the last object.
-            replace_right(root, obj_pair.first, obj_pair.second);
+            // Insert the member call in place of the last object.
+            replace_right(arena, root, member_node);
 
             // Now expecting operator.
             expecting_op = true;
@@ -335,19 +315,22 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
         }
 
         // Anything else should be considered unexpected.
-        throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+        throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
 
     }
 
     // If we are not expecting an operation, throw.
     if (!expecting_op) {
-        throw_error(ERR_SYNTAX, _tokens[__end_idx]->_token, _tokens[__end_idx]->_colnum, _tokens[__end_idx]->_linenum);
+        throw_error(ERR_SYNTAX, _tokens.text(__end_idx), _tokens[__end_idx]._colnum, _tokens[__end_idx]._linenum);
     }
 
-    // print_inorder(root);
+    // Fold the constant parts of the tree.
+    fold_expr(root);
+
+    // print_inorder(arena, _tokens, root);
 
-    // Send parse tree to evaluator.
-    return evaluate(root, _var_table, true, __scope, _recursive_index);
+    // Return the parse tree.
+    return root;
 
 }
 
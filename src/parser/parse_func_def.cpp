@@ -5,52 +5,53 @@
 //
 //  Description:                This file is responsible for parsing
 //                              user defined function definitions started
-//                              with the keyword 'func' and adding the
-//                              functions to the function table.
+//                              with the keyword 'func'. The executor adds
+//                              the functions to the function table when
+//                              the definition is reached.
 //
 //  Dependencies:               lexer_utils.hpp
 //                              parser_utils.hpp
 //                              error_handler.hpp
-//                              evaluator.hpp
-//                              variable_handler.hpp
-//                              function_handler.hpp
-//                              rosky_interface.hpp
 //
 //  Classes:                    Parser_T
 //
 //  Inherited Subprograms:      None
 //
 //  Exported Subprograms:       parse_func_def
+//                              parse_return
 //                              
 /******************************************************************************/
 
 #include "../../includes/parser.hpp"
 
-#include <iostream>
-
 /******************************************************************************/
 
-void Parser_T::parse_func_def(size_t& __idx, size_t __end_idx, size_t __scope) {
+std::shared_ptr<StmtNode> Parser_T::parse_func_def(size_t& __idx, size_t __end_idx) {
 
     // Increment the index.
     if (__idx + 1 >= __end_idx || __idx + 1 >= _tokens.size()) {
-        throw_error(ERR_UNEXP_EOF, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+        throw_error(ERR_UNEXP_EOF, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
     }
 
     __idx++;
 
     // Bookmark the function name and token column and linenum.
-    std::string func_name = _tokens[__idx]->_token;
-    size_t func_col = _tokens[__idx]->_colnum;
-    size_t func_lin = _tokens[__idx]->_linenum;
+    std::string func_name = _tokens.text(__idx);
+    size_t func_col = _tokens[__idx]._colnum;
+    size_t func_lin = _tokens[__idx]._linenum;
 
-    // Check if the function name is a native function or a keyword.
-    if (is_reserved(func_name)) {
+    // Check if the function name is a keyword. Clashes with function
+    // names are checked by the executor when the definition is reached.
+    if (_tokens[__idx]._type == TOKEN_KW) {
         throw_error(ERR_RESERVED_USE, func_name, func_col, func_lin);
     }
 
+    // Create the definition statement.
+    auto stmt = std::make_shared<StmtNode>(STMT_FUNC_DEF, func_col, func_lin);
+    stmt->_name = func_name;
+
     // Find the opening parentheses.
-    size_t open_index = find_nextof(_tokens, __idx, "(");
+    size_t open_index = find_nextof(_index, __idx, KIND_LPAREN);
 
     // The opening parentheses must be the next token.
     if (open_index == 0 || open_index != __idx + 1) {
@@ -61,16 +62,13 @@ void Parser_T::parse_func_def(size_t& __idx, size_t __end_idx, size_t __scope) {
     __idx = open_index;
 
     // Find the closing parentheses.
-    size_t close_index = find_matching_ctrl(_tokens, __idx, "(");
+    size_t close_index = find_matching_ctrl(_index, __idx);
 
     // Check if the close index was not found.
     if (close_index == 0 || close_index > __end_idx) {
-        throw_error(ERR_UNCLOSED_PAREN, "", _tokens[open_index]->_colnum, _tokens[open_index]->_linenum);
+        throw_error(ERR_UNCLOSED_PAREN, "", _tokens[open_index]._colnum, _tokens[open_index]._linenum);
     }
 
-    // Create a vector to hold the parameter symbols.
-    std::vector<std::string> func_params;
-
     // If the close_index is directly after the open_index, skip param collection.
     if (open_index + 1 != close_index) {
 
@@ -78,7 +76,7 @@ void Parser_T::parse_func_def(size_t& __idx, size_t __end_idx, size_t __scope) {
         bool has_comma = false;
 
         // Collect symbols until no more commas.
-        size_t comma_idx = find_nextof(_tokens, ++__idx, ",");
+        size_t comma_idx = find_nextof(_index, ++__idx, KIND_COMMA);
 
         // While the comma comes before the close paren index.
         while (comma_idx != 0 && comma_idx < close_index) {
@@ -88,57 +86,59 @@ void Parser_T::parse_func_def(size_t& __idx, size_t __end_idx, size_t __scope) {
 
             // If the comma index is the next index, throw an error for empty arg.
             if (comma_idx == __idx) {
-                throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+                throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
-            // If the token is reserved, throw error.
-            if (is_reserved(_tokens[__idx]->_token)) {
-                throw_error(ERR_RESERVED_USE, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+            // If the token is a keyword, throw error.
+            if (_tokens[__idx]._type == TOKEN_KW) {
+                throw_error(ERR_RESERVED_USE, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
             // If the current token is not a symbol, throw error.
-            if (_tokens[__idx]->_type != TOKEN_SYMBOL) {
-                throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+            if (_tokens[__idx]._type != TOKEN_SYMBOL) {
+                throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
             }
 
             // The comma must be the next index, otherwise throw syntax.
             if (comma_idx != __idx + 1) {
-                throw_error(ERR_SYNTAX, _tokens[__idx+1]->_token, _tokens[__idx+1]->_colnum, _tokens[__idx+1]->_linenum);
+                throw_error(ERR_SYNTAX, _tokens.text(__idx+1), _tokens[__idx+1]._colnum, _tokens[__idx+1]._linenum);
             }
 
             // Push the symbol into the parameter list.
-            func_params.push_back(_tokens[__idx]->_token);
+            stmt->_params.push_back(_tokens.text(__idx));
+            stmt->_param_pos.push_back({_tokens[__idx]._colnum, _tokens[__idx]._linenum});
 
             // Increment the index.
             __idx++;
 
             // Find the next comma.
-            comma_idx = find_nextof(_tokens, ++__idx, ",");
+            comma_idx = find_nextof(_index, ++__idx, KIND_COMMA);
 
         }
 
         // If has comma and next index is the closing paren, throw empty arg.
         if (has_comma && __idx == close_index) {
-            throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+            throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
         }
 
-        // If the token is reserved, throw error.
-        if (is_reserved(_tokens[__idx]->_token)) {
-            throw_error(ERR_RESERVED_USE, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+        // If the token is a keyword, throw error.
+        if (_tokens[__idx]._type == TOKEN_KW) {
+            throw_error(ERR_RESERVED_USE, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
         }
 
         // If the current token is not a symbol, throw error.
-        if (_tokens[__idx]->_type != TOKEN_SYMBOL) {
-            throw_error(ERR_SYNTAX, _tokens[__idx]->_token, _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+        if (_tokens[__idx]._type != TOKEN_SYMBOL) {
+            throw_error(ERR_SYNTAX, _tokens.text(__idx), _tokens[__idx]._colnum, _tokens[__idx]._linenum);
         }
 
         // The close index must be next, otherwise throw syntax.
         if (close_index != __idx + 1) {
-            throw_error(ERR_SYNTAX, _tokens[__idx+1]->_token, _tokens[__idx+1]->_colnum, _tokens[__idx+1]->_linenum);
+            throw_error(ERR_SYNTAX, _tokens.text(__idx+1), _tokens[__idx+1]._colnum, _tokens[__idx+1]._linenum);
         }
 
         // Push the symbol into the parameter list.
-        func_params.push_back(_tokens[__idx]->_token);
+        stmt->_params.push_back(_tokens.text(__idx));
+        stmt->_param_pos.push_back({_tokens[__idx]._colnum, _tokens[__idx]._linenum});
 
     }
 
@@ -146,66 +146,80 @@ void Parser_T::parse_func_def(size_t& __idx, size_t __end_idx, size_t __scope) {
     __idx = close_index;
 
     // Find the open body bracket.
-    size_t open_body_index = find_nextof(_tokens, __idx, "{");
+    size_t open_body_index = find_nextof(_index, __idx, KIND_LBRACE);
 
     // If not found, throw error.
     if (open_body_index == 0 || open_body_index > __end_idx) {
-        throw_error(ERR_MISSING_BODY, "", _tokens[close_index]->_colnum, _tokens[close_index]->_linenum);
+        throw_error(ERR_MISSING_BODY, "", _tokens[close_index]._colnum, _tokens[close_index]._linenum);
     }
 
     // Find the closing body bracket.
-    size_t close_body_index = find_matching_ctrl(_tokens, open_body_index, "{");
+    size_t close_body_index = find_matching_ctrl(_index, open_body_index);
 
     // If not found, throw error.
     if (close_body_index == 0 || close_body_index > __end_idx) {
-        throw_error(ERR_UNCLOSED_BRACKET, "", _tokens[open_body_index]->_colnum, _tokens[open_body_index]->_linenum);
+        throw_error(ERR_UNCLOSED_BRACKET, "", _tokens[open_body_index]._colnum, _tokens[open_body_index]._linenum);
     }
 
-    // Push the user function into the table at current scope.
-    _func_table->add_user_function(func_name, func_params, __scope, open_body_index, close_body_index);
+    // Bookmark the previous state of the context flags. A function body
+    // is never inside of a loop.
+    bool loop_flag = _loop_flag;
+    bool func_flag = _func_flag;
+    _loop_flag = false;
+    _func_flag = true;
+
+    // The body's expressions are built in the function's own arena.
+    stmt->_arena = std::make_shared<ExprArena_T>();
+    stmt->_arena.swap(_arena);
+
+    // Parse the function body.
+    stmt->_stmts.push_back(parse_body(open_body_index, close_body_index));
+
+    // Reset the context flags and the arena.
+    _loop_flag = loop_flag;
+    _func_flag = func_flag;
+    stmt->_arena.swap(_arena);
 
     // Set the index to the close body index.
     __idx = close_body_index;
 
+    return stmt;
+
 }
 
 /******************************************************************************/
 
-void Parser_T::parse_return(size_t& __idx, size_t __end_idx, size_t __scope) {
+std::shared_ptr<StmtNode> Parser_T::parse_return(size_t& __idx, size_t __end_idx) {
 
     // If we are not in a function, throw error.
     if (_func_flag == false) {
-        throw_error(ERR_RESERVED_USE, "'return' not in function", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+        throw_error(ERR_RESERVED_USE, "'return' not in function", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
     }
 
     // Find the next ';'.
-    size_t end_token = find_nextof(_tokens, __idx, ";");
+    size_t end_token = find_nextof(_index, __idx, KIND_SEMI);
     
     // If not found, throw error.
     if (end_token == 0 || end_token > __end_idx) {
-        throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]->_colnum, _tokens[__end_idx - 1]->_linenum);
+        throw_error(ERR_MISSING_TERM, "", _tokens[__end_idx - 1]._colnum, _tokens[__end_idx - 1]._linenum);
     }
 
+    // Create the return statement.
+    auto stmt = std::make_shared<StmtNode>(STMT_RETURN, _tokens[__idx]._colnum, _tokens[__idx]._linenum);
+
     // Increment index.
     __idx++;
 
-    // If the end index is the next index, set the return object to a null type.
-    if (__idx == end_token) {
-
-        _parser_ret_obj = std::make_shared<RoskyNull>();
-        
-    } else {
-
-        // Parse the expression.
-        auto ret_obj = parse_expr(__idx, end_token, __scope);
-
-        // Set the return object to the ret_obj.
-        _parser_ret_obj = ret_obj.second;
-
+    // If the end index is the next index, there is no return expression,
+    // which returns a null type. Otherwise parse the expression.
+    if (__idx != end_token) {
+        stmt->_exprs.push_back(parse_expr(__idx, end_token));
     }
 
-    // Assert the return flag.
-    _return_flag = true;
+    // Set the index to the terminator.
+    __idx = end_token;
+
+    return stmt;
 
 }
 
@@ -4,40 +4,37 @@
 //  Source Name:                parse_group.cpp
 //
 //  Description:                This file is responsible for parsing
-//                              groups. It will form a RoskyGroup object
-//                              from a token table and a given start
-//                              iterator.
+//                              groups. It will form a group node holding
+//                              the element expressions from a token table
+//                              and a given start iterator.
 // 
 //
 //  Dependencies:               lexer_utils.hpp
 //                              parser_utils.hpp
 //                              error_handler.hpp
-//                              evaluator.hpp
-//                              variable_handler.hpp
-//                              rosky_interface.hpp
 //
 //  Classes:                    Parser_T
 //
 //  Inherited Subprograms:      None
 //
-//  Exported Subprograms:       parse_expr
+//  Exported Subprograms:       parse_group
 //                              
 /******************************************************************************/
 
 #include "../../includes/parser.hpp"
 
-#include "../../includes/objects/rosky_group.hpp"
-
 /******************************************************************************/
 
-std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
-    Parser_T::parse_group(size_t& __idx, size_t __end_idx, size_t __scope) {
+node_idx Parser_T::parse_group(size_t& __idx, size_t __end_idx) {
+
+    // Create the group node at the opening bracket.
+    node_idx group_node = _arena->add(PARSE_OPERAND, OPERAND_GROUP, __idx);
 
-    // Create a deque to hold the objects.
-    std::deque<std::shared_ptr<RoskyInterface>> obj_deque;
+    // Bookmark the argument stack the elements are collected on.
+    size_t mark = _arg_stack.size();
 
-    // Collect objects until no more commas.
-    size_t comma_idx = find_nextof(_tokens, ++__idx, ",");
+    // Collect elements until no more commas.
+    size_t comma_idx = find_nextof(_index, ++__idx, KIND_COMMA);
 
     // This flag marks if we have a comma.
     bool has_comma = false;
@@ -50,38 +47,35 @@ std::pair<std::shared_ptr<RoskyInterface>*, std::shared_ptr<RoskyInterface>>
 
         // If the comma is the next index, throw an error for an empty arg.
         if (comma_idx == __idx) {
-            throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+            throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
         }
 
-        // Parse the expression from this index, to the comma index.
-        auto obj_pair = parse_expr(__idx, comma_idx, __scope);
-
-        // Add the object to the deque.
-        obj_deque.push_back(obj_pair.second);
+        // Parse the expression from this index, to the comma index, and
+        // add it to the elements.
+        _arg_stack.push_back(parse_expr(__idx, comma_idx));
 
         // Find the next comma.
-        comma_idx = find_nextof(_tokens, ++__idx, ",");
+        comma_idx = find_nextof(_index, ++__idx, KIND_COMMA);
 
     }
 
     // If the next index is the closing bracket and no comma, return empty.
     if (__idx == __end_idx && !has_comma) {
-        return {nullptr, std::make_shared<RoskyGroup>(obj_deque)};
+        return group_node;
     }
 
     // If the next index is closing parentheses and comma, empty arg.
     if (__idx == __end_idx) {
-        throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]->_colnum, _tokens[__idx]->_linenum);
+        throw_error(ERR_EMPTY_ARG, "", _tokens[__idx]._colnum, _tokens[__idx]._linenum);
     }
 
-    // Parse the expression between this index and the end idx.
-    auto obj_pair = parse_expr(__idx, __end_idx, __scope);
-
-    // Add the object to the deque.
-    obj_deque.push_back(obj_pair.second);
+    // Parse the expression between this index and the end idx, and
+    // add it to the elements.
+    _arg_stack.push_back(parse_expr(__idx, __end_idx));
+    store_args(group_node, mark);
 
-    // Return the new object.
-    return {nullptr, std::make_shared<RoskyGroup>(obj_deque)};
+    // Return the new node.
+    return group_node;
 
 }
 
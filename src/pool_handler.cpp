@@ -0,0 +1,146 @@
+/******************************************************************************/
+//
+//  Source Name:                pool_handler.cpp
+//
+//  Description:                This file is responsible for allocating
+//                              the boxed runtime objects (strings, groups,
+//                              ranges and pointers) from slab pools rather
+//                              than the general heap.
+//
+//                              Slabs are never returned to the heap, as
+//                              objects held in static storage may still
+//                              be freed while the program exits.
+//
+//  Dependencies:               None
+//
+//  Classes:                    None
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       pool_alloc
+//                              pool_free
+//                              enable_pool_stats
+//
+/******************************************************************************/
+
+#include <cstdio>                       // fprintf
+#include <cstdlib>                      // atexit
+#include <new>                          // operator new, operator delete
+
+#include "../includes/pool_handler.hpp"
+
+/******************************************************************************/
+
+// This struct defines a freed block, which links to the next one on the
+// free list of its pool.
+struct FreeBlock_T {
+    FreeBlock_T* _next;
+};
+
+// This struct defines the pool of a size class.
+struct Pool_T {
+
+    // The freed blocks, and the unused part of the current slab.
+    FreeBlock_T* _free;
+    char* _slab_pos;
+    char* _slab_end;
+
+    // The number of allocations, how many reused a freed block, and the
+    // number of slabs carved.
+    size_t _allocs;
+    size_t _reuses;
+    size_t _slabs;
+
+};
+
+// The pool of each size class, and the allocations too large for any.
+static Pool_T pools[POOL_CLASS_COUNT];
+static size_t heap_allocs = 0;
+
+/******************************************************************************/
+
+// This function returns the size class of __size bytes, which is
+// POOL_CLASS_COUNT if the size is too large for the pools.
+static inline size_t get_class(size_t __size) noexcept {
+    return (__size + POOL_GRANULARITY - 1) / POOL_GRANULARITY - 1;
+}
+
+/******************************************************************************/
+
+void* pool_alloc(size_t __size) {
+
+    size_t cls = get_class(__size);
+    if (__size == 0 || cls >= POOL_CLASS_COUNT) {
+        heap_allocs++;
+        return ::operator new(__size);
+    }
+
+    Pool_T& pool = pools[cls];
+    pool._allocs++;
+
+    // Reuse a freed block first.
+    if (pool._free != nullptr) {
+        FreeBlock_T* block = pool._free;
+        pool._free = block->_next;
+        pool._reuses++;
+        return block;
+    }
+
+    // Otherwise carve one from the slab, starting a new one if it is
+    // used up.
+    size_t block_size = (cls + 1) * POOL_GRANULARITY;
+    if (pool._slab_pos == nullptr || pool._slab_end - pool._slab_pos < (ptrdiff_t)block_size) {
+        pool._slab_pos = static_cast<char*>(::operator new(POOL_SLAB_SIZE));
+        pool._slab_end = pool._slab_pos + POOL_SLAB_SIZE;
+        pool._slabs++;
+    }
+
+    void* block = pool._slab_pos;
+    pool._slab_pos += block_size;
+    return block;
+
+}
+
+void pool_free(void* __ptr, size_t __size) noexcept {
+
+    size_t cls = get_class(__size);
+    if (__size == 0 || cls >= POOL_CLASS_COUNT) {
+        ::operator delete(__ptr);
+        return;
+    }
+
+    FreeBlock_T* block = static_cast<FreeBlock_T*>(__ptr);
+    block->_next = pools[cls]._free;
+    pools[cls]._free = block;
+
+}
+
+/******************************************************************************/
+
+// This function prints the hit rate of every pool that was used.
+static void print_pool_stats() {
+
+    fprintf(stderr, "Pool stats:\n");
+
+    for (size_t cls = 0; cls < POOL_CLASS_COUNT; cls++) {
+
+        const Pool_T& pool = pools[cls];
+        if (pool._allocs == 0) {
+            continue;
+        }
+
+        fprintf(stderr, "  %4zu bytes: %zu allocs, %zu reused (%.1f%%), %zu slabs\n",
+                (cls + 1) * POOL_GRANULARITY, pool._allocs, pool._reuses,
+                100.0 * pool._reuses / pool._allocs, pool._slabs);
+
+    }
+
+    fprintf(stderr, "  heap: %zu allocs\n", heap_allocs);
+
+}
+
+void enable_pool_stats() {
+    atexit(print_pool_stats);
+}
+
+/******************************************************************************/
@@ -8,184 +8,193 @@
 //                              the parser to leverage.
 //
 //  Dependencies:               lexer_utils.hpp
-//                              variable_handler.hpp
 //                              rosky_interface.hpp
 //                              rosky_int.hpp
 //
 //  Classes:                    ParseNode
+//                              StmtNode
+//                              TokenIndex_T
 //
 //  Inherited Subprograms:      None
 //
 //  Exported Subprograms:       get_precedence
+//                              get_operator
 //                              insert_right
 //                              insert_op
+//                              replace_right
+//                              make_subexpr
 //                              is_expr_op
 //                              is_literal
-//                              is_assignment_op
 //                              is_right_assoc
-//                              is_left_assoc
+//                              index_tokens
 //                              find_nextof
-//                              find_matching_ctrl
 //                              form_object
 //                              
 /******************************************************************************/
 
 #include "../../includes/utils/parser_utils.hpp"
 
-/******************************************************************************/
+#if __cplusplus >= 201703L
+#include <charconv>                     // std::from_chars
+#endif
 
-void insert_right(std::shared_ptr<ParseNode>& __root,
-                  std::shared_ptr<RoskyInterface>* __obj_adr,
-                  const std::shared_ptr<RoskyInterface>& __obj,
-                  const std::string& __sym_string,
-                  size_t __col, size_t __lin,
-                  size_t __r_index) {
+#include <cerrno>                       // errno, ERANGE
+#include <cstdlib>                      // strtol, strtod
 
-    // Create the new node.
-    std::shared_ptr<ParseNode> new_node = std::make_shared<ParseNode>(__obj_adr, __obj, __sym_string, PARSE_OPERAND, __col, __lin, __r_index);
+/******************************************************************************/
+
+void insert_right(ExprArena_T& __arena, node_idx& __root, node_idx __node) {
 
     // If the root node is null, replace it with the new node.
-    if (__root == nullptr) {
-        __root = new_node;
+    if (__root == NO_NODE) {
+        __root = __node;
         return;
     }
 
-    // Create a pointer to move down the tree.
-    std::shared_ptr<ParseNode> cur = __root;
+    // Create an index to move down the tree.
+    node_idx cur = __root;
 
     // Continue moving right.
-    while (cur->_right != nullptr) {
-        cur = cur->_right;
+    while (__arena[cur]._right != NO_NODE) {
+        cur = __arena[cur]._right;
     }
 
     // Insert the new node as the right child of cur.
-    cur->_right = new_node;
+    __arena[cur]._right = __node;
 
     // Set the new node's parent to cur.
-    new_node->_parent = cur;
+    __arena[__node]._parent = cur;
 
 }
 
 /******************************************************************************/
 
-void insert_op(std::shared_ptr<ParseNode>& __root,
-               const std::string& __op,
-               size_t __col, size_t __lin) {
+void insert_op(ExprArena_T& __arena, node_idx& __root,
+               OPERATOR_TYPE __oper, uint32_t __token) {
 
     // Create the new node.
-    std::shared_ptr<ParseNode> new_node = std::make_shared<ParseNode>(nullptr, nullptr, __op, PARSE_OPERATOR, __col, __lin, 0);
+    node_idx new_node = __arena.add(PARSE_OPERATOR, OPERAND_NONE, __token);
+    __arena[new_node]._oper = __oper;
+
+    // Look up the new operator's precedence once.
+    size_t prec = get_precedence(__oper);
 
-    // Create a pointer to navigate the tree.
-    std::shared_ptr<ParseNode> cur = __root;
+    // Create an index to navigate the tree.
+    node_idx cur = __root;
 
     // If the root is empty, insert the operator as root.
-    if (cur == nullptr) {
+    if (cur == NO_NODE) {
         __root = new_node;
         return;
     }
 
     // while the current node is an operator.
-    while (cur->_type == PARSE_OPERATOR) {
+    while (__arena[cur]._type == PARSE_OPERATOR) {
 
         // If the current node's operator precedence is less than the
         // new operators precedence, move right.
         // Or if the operator's precedence is equal and the operator
         // is right-left associative.
-        if ((get_precedence(cur->_op) < get_precedence(__op)) ||
-            (get_precedence(cur->_op) == get_precedence(__op) &&
-             is_right_assoc(__op))) {
+        if ((get_precedence(__arena[cur]._oper) < prec) ||
+            (get_precedence(__arena[cur]._oper) == prec &&
+             is_right_assoc(__oper))) {
 
-            // If the right child is nullptr (only applies to unary ops),
+            // If the right child is null (only applies to unary ops),
             // insert the operator to the right and return, otherwise
             // continue.
-            if (cur->_right == nullptr) {
+            if (__arena[cur]._right == NO_NODE) {
 
-                new_node->_parent = cur;
-                cur->_right = new_node;
+                __arena[new_node]._parent = cur;
+                __arena[cur]._right = new_node;
                 return;
 
             }
-            cur = cur->_right;
+            cur = __arena[cur]._right;
             continue;
         }
 
         // If the current node's precedence is greater than or equal to
         // the new operator's precedence, make the current node the left
         // child of the new node and assign the root if needed.
-
-        // If the node we are shifting down is the root, ensure
-        // we reassign the root.
-        if (__root.get() == cur.get()) {
-            __root = new_node;
-        }
-
-        // Set the current node as the left child of the new node.
-        new_node->_parent = cur->_parent;
-        cur->_parent = new_node;
-        new_node->_left = cur;
-
-        // If the parent is not null, set it's right child as the new node.
-        if (new_node->_parent.lock() != nullptr) {
-            new_node->_parent.lock()->_right = new_node;
-        }
-
-        // Work's done.
-        return;
+        break;
 
     }
 
-    // The node must be a symbol or integer, so make the new node
-    // the current node's parent, and make the current node the left
-    // child of the new node.
+    // Otherwise the current node is a symbol or integer, or an operator
+    // binding at least as tightly, so make the new node the current
+    // node's parent, and make the current node the left child of the
+    // new node.
 
     // If the current node is the root, ensure we reassign the root.
-    if (__root.get() == cur.get()) {
+    if (__root == cur) {
         __root = new_node;
     }
 
     // Set the current node as the left child of the new node.
-    new_node->_parent = cur->_parent;
-    cur->_parent = new_node;
-    new_node->_left = cur;
+    node_idx parent = __arena[cur]._parent;
+    __arena[new_node]._parent = parent;
+    __arena[cur]._parent = new_node;
+    __arena[new_node]._left = cur;
 
     // If the parent is not null, set its right child as the new node.
-    if (new_node->_parent.lock() != nullptr) {
-        new_node->_parent.lock()->_right = new_node;
+    if (parent != NO_NODE) {
+        __arena[parent]._right = new_node;
     }
 
 }
 
 /******************************************************************************/
 
-void replace_right(std::shared_ptr<ParseNode>& __root,
-                   std::shared_ptr<RoskyInterface>* __obj_adr,
-                   const std::shared_ptr<RoskyInterface>& __obj) {
+void replace_right(ExprArena_T& __arena, node_idx& __root, node_idx __node) {
+
+    // Create an index to traverse the tree.
+    node_idx cur = __root;
 
-    // Create a pointer to traverse the tree.
-    std::shared_ptr<ParseNode> cur = __root;
+    // Move while right is not null.
+    while (__arena[cur]._right != NO_NODE) {
+        cur = __arena[cur]._right;
+    }
+
+    // If cur is the root, the new node becomes the root.
+    if (cur == __root) {
+        __root = __node;
+        return;
+    }
+
+    // Otherwise hang the new node off of cur's parent.
+    node_idx parent = __arena[cur]._parent;
+    __arena[parent]._right = __node;
+    __arena[__node]._parent = parent;
+
+}
 
-    // Move while right is not nullptr.
-    while (cur->_right != nullptr) {
-        cur = cur->_right;
+/******************************************************************************/
+
+node_idx make_subexpr(ExprArena_T& __arena, node_idx __sub_root, uint32_t __token) {
+
+    // An operand is already a leaf, so it can be inserted directly.
+    if (__arena[__sub_root]._type == PARSE_OPERAND) {
+        return __sub_root;
     }
 
-    // Replace cur's contents with the provided objects.
-    cur->_obj_adr = __obj_adr;
-    cur->_obj = __obj;
-    cur->_op = "";
+    // Otherwise, hide the operator tree behind an operand node.
+    node_idx node = __arena.add(PARSE_OPERAND, OPERAND_EXPR, __token);
+    __arena[node]._target = __sub_root;
+
+    return node;
 
 }
 
 /******************************************************************************/
 
-std::shared_ptr<ParseNode> get_last_obj(const std::shared_ptr<ParseNode>& __root) {
+node_idx get_last_obj(const ExprArena_T& __arena, node_idx __root) {
 
-    // Create a pointer to traverse the tree.
-    std::shared_ptr<ParseNode> cur = __root;
+    // Create an index to traverse the tree.
+    node_idx cur = __root;
 
-    // Move while right is not nullptr.
-    while (cur->_right != nullptr) {
-        cur = cur->_right;
+    // Move while right is not null.
+    while (__arena[cur]._right != NO_NODE) {
+        cur = __arena[cur]._right;
     }
 
     // Return cur.
@@ -195,156 +204,177 @@ std::shared_ptr<ParseNode> get_last_obj(const std::shared_ptr<ParseNode>& __root
 
 /******************************************************************************/
 
-void print_inorder(const std::shared_ptr<ParseNode>& __root) {
+void print_inorder(const ExprArena_T& __arena, const TokenTable_T& __tokens, node_idx __root) {
 
-    if (__root == nullptr) { return; }
+    if (__root == NO_NODE) { return; }
 
-    print_inorder(__root->_left);
+    const ParseNode& node = __arena[__root];
 
-    if (__root->_type == PARSE_OPERAND) {
-        std::cout << __root->_obj->to_string() << std::endl;
+    print_inorder(__arena, __tokens, node._left);
+
+    if (node._operand == OPERAND_EXPR) {
+        print_inorder(__arena, __tokens, node._target);
+    } else if (node._operand == OPERAND_CONST) {
+        std::cout << __arena._consts[node._args].to_string() << std::endl;
     } else {
-        std::cout << __root->_op << std::endl;
+        std::cout << __tokens.text(node._token) << std::endl;
     }
 
-    print_inorder(__root->_right);
+    print_inorder(__arena, __tokens, node._right);
 
 }
 
 /******************************************************************************/
 
-size_t find_nextof(const std::deque<std::shared_ptr<Token_T>>& __tokens,
-                    size_t __start_idx, const std::string& __token) {
+TokenIndex_T index_tokens(const TokenTable_T& __tokens) {
 
-    // Iterate through the token table.
-    for (size_t idx = __start_idx; idx < __tokens.size(); idx++) {
+    TokenIndex_T index;
+    size_t size = __tokens.size();
 
-        // The token can't be in a closure, so if we find start
-        // start of a closure, skip over it.
-        if (__tokens[idx]->_type != TOKEN_LIT_STRING) {
+    // Match the closures. Each kind of closure is matched separately, and
+    // string literals never open or close one.
+    index._match.assign(size, 0);
+    std::vector<uint32_t> open[3];
 
-            if (__tokens[idx]->_token == "[" ||
-                __tokens[idx]->_token == "{" ||
-                __tokens[idx]->_token == "(") {
+    for (size_t idx = 0; idx < size; idx++) {
 
-                if (__tokens[idx]->_token == __token) {
-                    return idx;
-                }
+        // The stack of the closure kind, and whether this token closes it.
+        std::vector<uint32_t>* stack;
+        bool close;
 
-                size_t match_idx = find_matching_ctrl(__tokens, idx, __tokens[idx]->_token);
+        switch (__tokens[idx]._kind) {
+            case KIND_LPAREN:   stack = &open[0]; close = false; break;
+            case KIND_LBRACKET: stack = &open[1]; close = false; break;
+            case KIND_LBRACE:   stack = &open[2]; close = false; break;
+            case KIND_RPAREN:   stack = &open[0]; close = true; break;
+            case KIND_RBRACKET: stack = &open[1]; close = true; break;
+            case KIND_RBRACE:   stack = &open[2]; close = true; break;
+            default: continue;
+        }
 
-                idx = match_idx == 0 ? idx : match_idx;
-                continue;
+        if (!close) {
+            stack->push_back(idx);
+        } else if (!stack->empty()) {
+            index._match[stack->back()] = idx;
+            stack->pop_back();
+        }
 
-            }
+    }
+
+    // Find the next of each token, walking backwards so that the search
+    // from the token after a closure is already known.
+    for (auto& next : index._next) {
+        next.assign(size + 1, 0);
+    }
 
+    for (size_t idx = size; idx-- > 0;) {
+
+        // The token each table searches for, if this token is one.
+        int found = FIND_COUNT;
+        switch (__tokens[idx]._kind) {
+            case KIND_SEMI:   found = FIND_SEMI; break;
+            case KIND_COMMA:  found = FIND_COMMA; break;
+            case KIND_LPAREN: found = FIND_PAREN; break;
+            case KIND_LBRACE: found = FIND_BRACE; break;
+            default: break;
         }
 
-        // If the token matches and not a string literal, return the index.
-        if (__tokens[idx]->_token == __token && __tokens[idx]->_type != TOKEN_LIT_STRING) {
-            return idx;
+        // The search skips over a closure it does not start at.
+        size_t resume = index._match[idx] != 0 ? index._match[idx] + 1 : idx + 1;
+
+        for (int tok = 0; tok < FIND_COUNT; tok++) {
+            index._next[tok][idx] = tok == found ? idx : index._next[tok][resume];
         }
 
     }
 
-    // Not found, return 0
-    return 0;
+    return index;
 
 }
 
 /******************************************************************************/
 
-size_t find_matching_ctrl(const std::deque<std::shared_ptr<Token_T>>& __tokens,
-                            size_t __start_idx, const std::string& __token) {
+size_t find_nextof(const TokenIndex_T& __index, size_t __start_idx, TOKEN_KIND __kind) {
 
-    // This holds the number of open tokens.
-    size_t open_count = 0;
+    FIND_TOKEN tok;
+    switch (__kind) {
+        case KIND_SEMI:   tok = FIND_SEMI; break;
+        case KIND_COMMA:  tok = FIND_COMMA; break;
+        case KIND_LPAREN: tok = FIND_PAREN; break;
+        default:          tok = FIND_BRACE; break;
+    }
 
-    // Mark the close token based on the provided token.
-    std::string close_token;
-    close_token = __token == "(" ? ")" : __token == "[" ? "]" : "}";
+    // Searches may start one past the last token.
+    if (__start_idx >= __index._next[tok].size()) {
+        return 0;
+    }
 
-    // Iterate through the table.
-    for (size_t idx = __start_idx; idx < __tokens.size(); idx++) {
+    return __index._next[tok][__start_idx];
 
-        // If open structure, increment the count.
-        if (__tokens[idx]->_token == __token) {
-            open_count++;
-            continue;
-        }
+}
 
-        // If close structure, check if found match, otherwise,
-        // decrement the count.
-        if (__tokens[idx]->_token == close_token) {
-            open_count--;
-            if (open_count == 0) {
-                return idx;
-            }
-            continue;
-        }
+/******************************************************************************/
 
-    }
+// These functions parse the number at the start of a numeric literal's
+// text. Returns false if it is out of range. Without std::from_chars,
+// the C library is used instead.
+static bool parse_number(const std::string& __text, long& __data) noexcept {
 
-    // No match found, return 0.
-    return 0;
+#if defined(__cpp_lib_to_chars)
+    return std::from_chars(__text.data(), __text.data() + __text.size(), __data).ec == std::errc();
+#else
+    errno = 0;
+    __data = strtol(__text.c_str(), nullptr, 10);
+    return errno != ERANGE;
+#endif
 
 }
 
-/******************************************************************************/
+static bool parse_number(const std::string& __text, double& __data) noexcept {
 
-std::shared_ptr<ObjectForm_T> form_object(const std::shared_ptr<Token_T>& __token,
-                std::unique_ptr<VariableTable_T>& __var_table,
-                size_t __scope, size_t __r_index) {
+#if defined(__cpp_lib_to_chars)
+    return std::from_chars(__text.data(), __text.data() + __text.size(), __data).ec == std::errc();
+#else
+    errno = 0;
+    __data = strtod(__text.c_str(), nullptr);
+    return errno != ERANGE;
+#endif
 
-    // Literals
-    if (__token->_type == TOKEN_LIT_INT) {
-        return std::make_shared<ObjectForm_T>
-            (nullptr, std::make_shared<RoskyInt>(std::stoi(__token->_token)), __r_index);
-    }
-    if (__token->_type == TOKEN_LIT_FLOAT) {
-        return std::make_shared<ObjectForm_T>
-            (nullptr, std::make_shared<RoskyFloat>(std::stod(__token->_token)), __r_index);
-    }
-    if (__token->_type == TOKEN_LIT_STRING) {
-        return std::make_shared<ObjectForm_T>
-            (nullptr, std::make_shared<RoskyString>(__token->_token), __r_index);
-    }
+}
 
-    // Symbols
-    if (__token->_type == TOKEN_SYMBOL) {
+/******************************************************************************/
 
-        auto ret = __var_table->get_entry(__token->_token);
-        if (ret.first != nullptr) {
-            return std::make_shared<ObjectForm_T>
-                (ret.first, *ret.first, ret.second);
-        }
-    }
+RoskyValue form_object(TOKEN_KIND __kind, const std::string& __text) {
 
-    // Keywords
-    if (__token->_type == TOKEN_KW) {
+    switch (__kind) {
 
-        if (__token->_token == "null") {
-            return std::make_shared<ObjectForm_T>
-                (nullptr, std::make_shared<RoskyNull>(), __r_index);
+        // Literals
+        case KIND_INT: {
+            long data = 0;
+            return parse_number(__text, data) ? RoskyValue::make_int(data) : RoskyValue();
         }
-        if (__token->_token == "nullptr") {
-            return std::make_shared<ObjectForm_T>
-                (nullptr, std::make_shared<RoskyPointer>(nullptr), __r_index);
-        }
-        if (__token->_token == "true") {
-            return std::make_shared<ObjectForm_T>
-                (nullptr, std::make_shared<RoskyBool>(true), __r_index);
-        }
-        if (__token->_token == "false") {
-            return std::make_shared<ObjectForm_T>
-                (nullptr, std::make_shared<RoskyBool>(false), __r_index);
+        case KIND_FLOAT: {
+            double data = 0;
+            return parse_number(__text, data) ? RoskyValue::make_float(data) : RoskyValue();
         }
+        case KIND_STRING:
+            return RoskyValue::make_string(__text);
+
+        // Keywords
+        case KIND_NULL:
+            return RoskyValue::make_null();
+        case KIND_NULLPTR:
+            return RoskyValue::make_nullptr();
+        case KIND_TRUE:
+            return RoskyValue::make_bool(true);
+        case KIND_FALSE:
+            return RoskyValue::make_bool(false);
+
+        default:
+            return RoskyValue();
 
     }
 
-    return std::make_shared<ObjectForm_T>
-        (nullptr, nullptr, 0);
-
 }
 
 /******************************************************************************/
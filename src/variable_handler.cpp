@@ -5,11 +5,13 @@
 //
 //  Description:                This file is responsible managing the
 //                              variable/symbol table. It contains
-//                              functions to get and set different
-//                              entries in the table.
+//                              functions to push and pop the variable
+//                              slots of each frame.
 // 
-//                              The data structure for the variable
-//                              table is a deque.
+//                              Variables are resolved to a slot index by
+//                              the compiler, so the table is a single
+//                              stack of slots that every frame takes a
+//                              contiguous run of.
 //
 //  Dependencies:               rosky_interface.hpp
 //
@@ -18,8 +20,9 @@
 //
 //  Inherited Subprograms:      None
 //
-//  Exported Subprograms:       get_entry
-//                              set_entry
+//  Exported Subprograms:       reserve
+//                              push_frame
+//                              pop_frame
 //                              
 /******************************************************************************/
 
@@ -27,50 +30,23 @@
 
 /******************************************************************************/
 
-void VariableTable_T::set_entry(const std::string& __var_name,
-                                const std::shared_ptr<RoskyInterface>& __val,
-                                size_t __scope, size_t __r_index) noexcept {
-    
-    // Create a new entry.
-    var_table.emplace_front(__var_name, __val, __scope, __r_index);
+void VariableTable_T::reserve(size_t __num_slots) noexcept {
 
-}
-
-/******************************************************************************/
-
-std::pair<std::shared_ptr<RoskyInterface>*, size_t>
-        VariableTable_T::get_entry(const std::string& __var_name) noexcept {
-
-    for (auto& var : var_table) {
-        if (var._name == __var_name) {
-            return {&(var._obj), var._recurisve_index};
-        }
-    }
-
-    return {nullptr, 0};
+    _slots.resize(__num_slots);
 
 }
 
 /******************************************************************************/
 
-void VariableTable_T::release_above_scope(size_t __scope) noexcept {
+void VariableTable_T::pop_frame(size_t __num_slots) noexcept {
 
-    std::deque<size_t> deletion;
+    _top -= __num_slots;
 
-    size_t idx = 0;
-    for (auto& var : var_table) {
-        if (var._scope >= __scope) {
-            deletion.push_front(idx);
-        }
-        idx++;
-    }
-
-    for (auto it = deletion.begin(); it != deletion.end(); it++) {
-        auto list_it = var_table.begin();
-        std::next(list_it, *it);
-        var_table.erase(list_it);
+    // Release the frame's variables.
+    for (size_t slot = _top; slot < _top + __num_slots; slot++) {
+        _slots[slot]._obj = RoskyValue();
     }
 
 }
 
-/******************************************************************************/
\ No newline at end of file
+/******************************************************************************/
@@ -0,0 +1,631 @@
+/******************************************************************************/
+//
+//  Source Name:                virtual_machine.cpp
+//
+//  Description:                This file is responsible for executing
+//                              the bytecode generated by the compiler.
+//                              Instructions are dispatched from a single
+//                              loop, and user function calls push a
+//                              frame onto the frame stack rather than
+//                              recursing.
+//
+//                              The virtual machine will catch logical
+//                              errors that can only be known at runtime.
+//
+//  Dependencies:               compiler_utils.hpp
+//                              parser_utils.hpp
+//                              error_handler.hpp
+//                              variable_handler.hpp
+//                              function_handler.hpp
+//                              rosky_interface.hpp
+//
+//  Classes:                    VirtualMachine_T
+//
+//  Inherited Subprograms:      None
+//
+//  Exported Subprograms:       run
+//
+/******************************************************************************/
+
+#include "../includes/virtual_machine.hpp"
+
+/******************************************************************************/
+
+void VirtualMachine_T::run(const std::shared_ptr<Chunk_T>& __chunk) {
+
+    // The frame and slot stacks are allocated once, large enough for the
+    // deepest chain of calls, so pushing a frame never moves them.
+    _frames.reserve(MAX_CALL_DEPTH + 1);
+    _var_table->reserve(__chunk->_num_slots + MAX_CALL_DEPTH * max_func_slots(__chunk.get()));
+
+    // Push the frame of the main chunk.
+    VariableEntry_T* locals = _var_table->push_frame(__chunk->_num_slots);
+    _frames.push_back({__chunk.get(), 0, locals, 0, 0});
+
+    // The state of the executing frame is held locally, and written
+    // back to the frame stack on calls.
+    const Chunk_T* chunk = __chunk.get();
+    size_t ip = 0;
+
+    // Dispatch loop.
+    while (true) {
+
+        const Instr_T& instr = chunk->_code[ip];
+        size_t col = chunk->_pos[ip].first;
+        size_t lin = chunk->_pos[ip].second;
+        ip++;
+
+        switch (instr._op) {
+
+            case OP_LOAD_CONST:
+                _stack.push_back({nullptr, chunk->_consts[instr._a]});
+                break;
+
+            case OP_LOAD_LOCAL: {
+
+                VariableEntry_T& entry = locals[instr._a];
+
+                if (!entry._obj.is_empty()) {
+                    _stack.push_back({&entry._obj, entry._obj});
+                    break;
+                }
+
+                // The variable is not bound in this frame yet, so it may
+                // belong to a caller.
+                obj* found = find_name(chunk->_name_ids[instr._b]);
+
+                // If the symbol is not found, it is unrecognized.
+                if (found == nullptr) {
+                    throw_error(ERR_UNREC_SYM, chunk->_names[instr._b], col, lin);
+                }
+
+                _stack.push_back({found, *found});
+                break;
+
+            }
+
+            case OP_LOAD_NAME: {
+
+                obj* found = find_name(chunk->_name_ids[instr._a]);
+
+                // If the symbol is not found, it is unrecognized.
+                if (found == nullptr) {
+                    throw_error(ERR_UNREC_SYM, chunk->_names[instr._a], col, lin);
+                }
+
+                _stack.push_back({found, *found});
+                break;
+
+            }
+
+            case OP_STORE_LOCAL: {
+
+                // If the variable is bound in this frame, simply overwrite
+                // it. Otherwise, bind it at the current depth.
+                // The assigned object stays on the stack.
+                VariableEntry_T& entry = locals[instr._a];
+
+                if (entry._obj.is_empty()) {
+                    entry._scope = instr._b;
+                }
+                entry._obj = _stack.back().second;
+                break;
+
+            }
+
+            case OP_STORE_REF: {
+
+                // The l-value must be addressable, otherwise it's an r-value.
+                auto left = pop();
+
+                if (left.first == nullptr) {
+                    throw_error(ERR_BAD_ASSIGN, "", col, lin);
+                }
+
+                *(left.first) = _stack.back().second;
+                break;
+
+            }
+
+            case OP_POP:
+                _stack.pop_back();
+                break;
+
+            case OP_ADD:
+            case OP_SUB:
+            case OP_MUL:
+            case OP_DIV:
+            case OP_IDIV:
+            case OP_MOD:
+            case OP_CONCAT:
+            case OP_EQ:
+            case OP_NEQ:
+            case OP_GT:
+            case OP_LT:
+            case OP_GEQ:
+            case OP_LEQ:
+            case OP_AND:
+            case OP_OR:
+            case OP_XOR:
+            case OP_SWAP:
+            case OP_INDEX:
+            case OP_NOT:
+            case OP_DEREF:
+            case OP_ADDR: {
+
+                auto ret_obj = operate(instr._op, col, lin);
+                _stack.push_back(std::move(ret_obj));
+                break;
+
+            }
+
+            case OP_MAKE_GROUP: {
+
+                // Form the group from the top elements.
+                auto elems = pop_args(instr._a);
+                std::deque<obj> obj_deque(std::make_move_iterator(elems.begin()),
+                                          std::make_move_iterator(elems.end()));
+                _stack.push_back({nullptr, make_object<RoskyGroup>(std::move(obj_deque))});
+                break;
+
+            }
+
+            case OP_CALL: {
+
+                const std::string& func_name = chunk->_names[instr._a];
+                FunctionTable_T::Callee_T callee = _func_table->resolve(chunk->_name_ids[instr._a], func_name);
+
+                // Check if the function is a native function.
+                if (callee._native != nullptr) {
+                    auto func_args = pop_args(instr._b);
+                    _stack.push_back(callee._native(func_args, col, lin));
+                    break;
+                }
+
+                // Get the user function entry.
+                const UserFunction_T* user_func_entry = callee._user;
+
+                // If the function is neither, throw an error.
+                if (user_func_entry == nullptr) {
+                    throw_error(ERR_UNREC_FUNC, "'" + func_name + "'", col, lin);
+                }
+
+                // Ensure the parameter counts match.
+                if (instr._b != user_func_entry->_func_params.size()) {
+                    throw_error(ERR_BAD_FUNC_ARGS, "'" + func_name + "' expects " +
+                                std::to_string(user_func_entry->_func_params.size()) +
+                                " arguments, received " + std::to_string(instr._b),
+                                col, lin);
+                }
+
+                // Check if the maximum recursion depth has been exceeded.
+                if (_frames.size() > MAX_CALL_DEPTH) {
+                    throw_error(ERR_MAX_RECURSION_DEPTH, "", col, lin);
+                }
+
+                // Push the callee's slots, and move the arguments off of the
+                // operand stack into the first slots. The parameters are
+                // never released by the function's scopes.
+                size_t arg_base = _stack.size() - instr._b;
+                locals = _var_table->push_frame(user_func_entry->_chunk->_num_slots);
+                for (size_t param_idx = 0; param_idx < instr._b; param_idx++) {
+                    locals[param_idx]._obj = std::move(_stack[arg_base + param_idx].second);
+                    locals[param_idx]._scope = 0;
+                }
+                _stack.resize(arg_base);
+
+                // Save the caller's position and push the callee's frame.
+                // The return value is left where the arguments were.
+                _frames.back()._ip = ip;
+                _frames.push_back({user_func_entry->_chunk.get(), 0, locals,
+                                   _iters.size(), arg_base});
+
+                chunk = user_func_entry->_chunk.get();
+                ip = 0;
+                break;
+
+            }
+
+            case OP_CALL_MEMBER: {
+
+                const std::string& func_name = chunk->_names[instr._a];
+
+                // Pop the function arguments, then the object they act on.
+                auto func_args = pop_args(instr._b);
+                auto target = pop();
+
+                // If the member function does not exist, throw an error.
+                FunctionTable_T::native_member_func member_func =
+                    _func_table->resolve_member(chunk->_name_ids[instr._a], func_name);
+
+                if (member_func == nullptr) {
+                    throw_error(ERR_UNREC_FUNC, "'" + func_name + "'", col, lin);
+                }
+
+                // Call the function with the args.
+                _stack.push_back(member_func(target, func_args, col, lin));
+                break;
+
+            }
+
+            case OP_RETURN: {
+
+                // A bare return returns a null type.
+                obj ret_obj = instr._a ? pop().second : obj::make_null();
+
+                // Unwind anything the frame left behind.
+                Frame_T frame = _frames.back();
+                _frames.pop_back();
+                _iters.resize(frame._iter_base);
+                _stack.resize(frame._stack_base);
+
+                // Returning from the main chunk ends the program.
+                if (_frames.empty()) {
+                    return;
+                }
+
+                // Release the frame's variables.
+                _var_table->pop_frame(chunk->_num_slots);
+
+                // Resume the caller.
+                chunk = _frames.back()._chunk;
+                ip = _frames.back()._ip;
+                locals = _frames.back()._locals;
+
+                _stack.push_back({nullptr, ret_obj});
+                break;
+
+            }
+
+            case OP_DEF_FUNC:
+                define_func(chunk->_funcs[instr._a], col, lin);
+                break;
+
+            case OP_JUMP:
+                ip = instr._a;
+                break;
+
+            case OP_JUMP_AND:
+            case OP_JUMP_OR: {
+
+                // A boolean that decides the result is kept as a temporary.
+                // Anything else is left for the operator to check.
+                obj_pair& left = _stack.back();
+
+                if (left.second.get_type_id() == OBJ_BOOL &&
+                    left.second.to_bool() == (instr._op == OP_JUMP_OR)) {
+                    left.first = nullptr;
+                    ip = instr._a;
+                }
+                break;
+
+            }
+
+            case OP_JUMP_IF_FALSE: {
+
+                auto cond = pop();
+
+                // The condition must be a boolean, otherwise throw error.
+                if (cond.second.get_type_id() != OBJ_BOOL) {
+                    throw_error(ERR_BAD_COND_TYPE, "received '" + cond.second.get_type_string() + "'", col, lin);
+                }
+
+                if (cond.second.to_bool() == false) {
+                    ip = instr._a;
+                }
+                break;
+
+            }
+
+            case OP_RELEASE:
+
+                // Unbind the statement's variables that were bound within
+                // it.
+                for (size_t slot : chunk->_releases[instr._b]) {
+                    if (locals[slot]._scope >= instr._a) {
+                        locals[slot]._obj = obj();
+                    }
+                }
+                break;
+
+            case OP_ITER_INIT: {
+
+                auto iter_obj = pop();
+
+                // The object must be an iterable.
+                if (iter_obj.second.is_iterable() == false) {
+                    throw_error(ERR_NON_ITERABLE, iter_obj.second.to_string(), col, lin);
+                }
+
+                // Iterables are always boxed.
+                RoskyInterface* box = iter_obj.second.get_box();
+                _iters.push_back({std::move(iter_obj.second), box, box->begin()});
+
+                // The loop variable is bound at the loop's scope.
+                locals[instr._a]._scope = instr._b;
+                break;
+
+            }
+
+            case OP_ITER_NEXT: {
+
+                Iter_T& iter = _iters.back();
+
+                // If the iterable is exhausted, leave the loop.
+                if (iter._box->done(iter._pos)) {
+                    ip = instr._b;
+                    break;
+                }
+
+                // Assign the loop variable, and advance.
+                locals[instr._a]._obj = iter._box->next(iter._pos);
+                break;
+
+            }
+
+            case OP_ITER_END:
+                _iters.pop_back();
+                break;
+
+        }
+
+    }
+
+}
+
+/******************************************************************************/
+
+std::vector<VirtualMachine_T::obj> VirtualMachine_T::pop_args(size_t __count) {
+
+    // Copy the objects in the order they were pushed.
+    std::vector<obj> args;
+    args.reserve(__count);
+
+    for (size_t idx = _stack.size() - __count; idx < _stack.size(); idx++) {
+        args.push_back(std::move(_stack[idx].second));
+    }
+
+    _stack.resize(_stack.size() - __count);
+
+    return args;
+
+}
+
+/******************************************************************************/
+
+size_t VirtualMachine_T::max_func_slots(const Chunk_T* __chunk) const noexcept {
+
+    size_t max_slots = 0;
+
+    for (auto& func : __chunk->_funcs) {
+        max_slots = std::max(max_slots, func->_num_slots);
+        max_slots = std::max(max_slots, max_func_slots(func.get()));
+    }
+
+    return max_slots;
+
+}
+
+/******************************************************************************/
+
+VirtualMachine_T::obj* VirtualMachine_T::find_name(size_t __symbol) noexcept {
+
+    // Search the calling frames, most recent first. The executing frame
+    // never holds a binding its own chunk did not resolve.
+    for (size_t depth = _frames.size() - 1; depth-- > 0;) {
+
+        const Chunk_T* chunk = _frames[depth]._chunk;
+
+        auto it = chunk->_slot_map.find(__symbol);
+        if (it == chunk->_slot_map.end()) {
+            continue;
+        }
+
+        // The later slots of a name belong to loop variables, which shadow
+        // the earlier ones.
+        VariableEntry_T* slots = _frames[depth]._locals;
+        for (auto slot = it->second.rbegin(); slot != it->second.rend(); slot++) {
+            if (!slots[*slot]._obj.is_empty()) {
+                return &slots[*slot]._obj;
+            }
+        }
+
+    }
+
+    return nullptr;
+
+}
+
+/******************************************************************************/
+
+VirtualMachine_T::obj_pair VirtualMachine_T::operate(OPCODE_TYPE __op, size_t __col, size_t __lin) {
+
+    // Create a temp storage for the return value and the left and right operands.
+    obj_pair ret_obj = {nullptr, obj()};
+
+    auto right = pop();
+    obj_pair left = {nullptr, obj()};
+
+    // If the operator is not unary, pop the left side.
+    bool unary = __op == OP_NOT || __op == OP_DEREF || __op == OP_ADDR;
+    if (!unary) {
+        left = pop();
+    }
+
+    // Perform the operation.
+    switch (__op) {
+
+        case OP_ADD:
+            ret_obj = {nullptr, left.second.add_op(right.second)};
+            break;
+        case OP_SUB:
+            ret_obj = {nullptr, left.second.sub_op(right.second)};
+            break;
+        case OP_MUL:
+            ret_obj = {nullptr, left.second.mul_op(right.second)};
+            break;
+        case OP_DIV:
+            ret_obj = {nullptr, left.second.div_op(right.second)};
+            break;
+        case OP_IDIV:
+            ret_obj = {nullptr, left.second.idiv_op(right.second)};
+            break;
+        case OP_MOD:
+            ret_obj = {nullptr, left.second.mod_op(right.second)};
+            break;
+        case OP_CONCAT:
+            ret_obj = {nullptr, left.second.concat_op(right.second)};
+            break;
+        case OP_EQ:
+            ret_obj = {nullptr, left.second.eq_op(right.second)};
+            break;
+        case OP_NEQ:
+            ret_obj = {nullptr, left.second.neq_op(right.second)};
+            break;
+        case OP_GT:
+            ret_obj = {nullptr, left.second.gt_op(right.second)};
+            break;
+        case OP_LT:
+            ret_obj = {nullptr, left.second.lt_op(right.second)};
+            break;
+        case OP_GEQ:
+            ret_obj = {nullptr, left.second.geq_op(right.second)};
+            break;
+        case OP_LEQ:
+            ret_obj = {nullptr, left.second.leq_op(right.second)};
+            break;
+        case OP_NOT:
+            ret_obj = {nullptr, right.second.not_op()};
+            break;
+        case OP_AND:
+            ret_obj = {nullptr, left.second.and_op(right.second)};
+            break;
+        case OP_XOR:
+            ret_obj = {nullptr, left.second.xor_op(right.second)};
+            break;
+        case OP_OR:
+            ret_obj = {nullptr, left.second.or_op(right.second)};
+            break;
+
+        case OP_SWAP:
+
+            // This operator will only have an affect on addressable
+            // objects.
+            if (left.first != nullptr && right.first != nullptr) {
+                *left.first = right.second;
+                *right.first = left.second;
+            } else if (left.first != nullptr && right.first == nullptr) {
+                *left.first = right.second;
+            } else if (left.first == nullptr && right.first != nullptr) {
+                *right.first = left.second;
+            }
+            ret_obj = {nullptr, obj::make_null()};
+            break;
+
+        case OP_INDEX: {
+
+            // If the left object is not iterable, throw error.
+            if (left.second.is_iterable() == false) {
+                throw_error(ERR_NON_ITERABLE, "'" + left.second.get_type_string() + "'", __col, __lin);
+            }
+
+            // Check if the operation should return an addressable object.
+            bool addressable = false;
+            if (left.first != nullptr) {
+                if (left.first->is_addressable()) {
+                    addressable = true;
+                }
+            }
+
+            // Perform the operation.
+            if (addressable) {
+                ret_obj = left.first->index_op(right.second);
+            } else {
+                ret_obj = left.second.index_op(right.second);
+                ret_obj.first = nullptr;
+            }
+
+            // Special case of index oob.
+            if (right.second.get_type_id() == OBJ_INT &&
+                ret_obj.first == nullptr && ret_obj.second.is_empty()) {
+                throw_error(ERR_INDEX_OOB, right.second.to_string(), __col, __lin);
+            }
+            break;
+
+        }
+
+        case OP_DEREF:
+            ret_obj = right.second.deref_op();
+
+            // Special case where we try to dereference a nullptr.
+            if (ret_obj.second.is_empty() && right.second.get_type_id() == OBJ_POINTER) {
+                throw_error(ERR_DEREF_NULLPTR, "", __col, __lin);
+            }
+            break;
+
+        case OP_ADDR:
+
+            // If the .first attribute of the right object is nullptr,
+            // then we are trying to get the address of a temporary.
+            if (right.first == nullptr) {
+                throw_error(ERR_ADDR_TEMP, "", __col, __lin);
+            }
+
+            ret_obj = {nullptr, make_object<RoskyPointer>(right.first)};
+            break;
+
+        default:
+            // Should never reach here, but for safety.
+            throw_error(ERR_UNEXP_OP, get_op_string(__op), __col, __lin);
+
+    }
+
+    // If the ret_obj is empty, the operator was incompat.
+    if (ret_obj.second.is_empty()) {
+
+        // Construct the error message
+        std::string err_msg = "'" + get_op_string(__op) + "'";
+
+        // Unary operator
+        if (unary) {
+            err_msg += " with type: '";
+            err_msg += right.second.get_type_string() + "'";
+        } else{
+            err_msg += " with types: '";
+            err_msg += left.second.get_type_string() + "' and '";
+            err_msg += right.second.get_type_string() + "'";
+        }
+
+        throw_error(ERR_OP_INCOMPAT, err_msg, __col, __lin);
+    }
+
+    // Return the object.
+    return ret_obj;
+
+}
+
+/******************************************************************************/
+
+void VirtualMachine_T::define_func(const std::shared_ptr<Chunk_T>& __func, size_t __col, size_t __lin) {
+
+    // The function name cannot clash with another function.
+    if (is_reserved(__func->_func_name)) {
+        throw_error(ERR_RESERVED_USE, __func->_func_name, __col, __lin);
+    }
+
+    // Neither can any of the parameters.
+    for (size_t param_idx = 0; param_idx < __func->_params.size(); param_idx++) {
+
+        if (is_reserved(__func->_params[param_idx])) {
+            throw_error(ERR_RESERVED_USE, __func->_params[param_idx],
+                        __func->_param_pos[param_idx].first, __func->_param_pos[param_idx].second);
+        }
+
+    }
+
+    // Push the user function into the table at current scope.
+    _func_table->add_user_function(__func->_func_name, __func->_params, _frames.size() - 1, __func);
+
+}
+
+/******************************************************************************/